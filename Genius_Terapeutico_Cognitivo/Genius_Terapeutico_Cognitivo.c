@@ -2,13 +2,20 @@
 #include <string.h>  // Inclui a biblioteca para manipulação de strings (como memset, strcpy, etc.)
 #include <stdlib.h>  // Inclui a biblioteca padrão (para funções como rand, srand, etc.)
 #include <ctype.h>   // Inclui a biblioteca para manipulação de caracteres (como isdigit, toupper, etc.)
-#include "pico/stdlib.h"  // Inclui a biblioteca padrão do Raspberry Pi Pico (para funções como sleep_ms, gpio_init, etc.)
-#include "pico/binary_info.h"  // Inclui a biblioteca para informações binárias (usada para depuração)
-#include "hardware/gpio.h"  // Inclui a biblioteca para controle de GPIO (para configurar pinos como entrada/saída)
-#include "hardware/pwm.h"  // Inclui a biblioteca para controle de PWM (para gerar sinais de áudio no buzzer)
-#include "hardware/adc.h"  // Inclui a biblioteca para controle do ADC (para ler valores analógicos do joystick)
-#include "hardware/i2c.h"  // Inclui a biblioteca para controle do I2C (para comunicação com o display OLED)
+#include <math.h>    // Inclui as funções matemáticas (sqrtf, para o desvio padrão)
+#include "pico/stdlib.h"  // Inclui a biblioteca padrão do Raspberry Pi Pico (tipos e macros básicos)
+#include "inc/hal.h"  // Inclui a camada de abstração do hardware (placa real ou simulador no PC)
 #include "inc/ssd1306.h"  // Inclui a biblioteca específica para controlar o display OLED SSD1306
+#include "inc/ui_service.h"  // Inclui o serviço de display e som (no núcleo 1, se habilitado)
+#include "inc/scheduler.h"  // Inclui o escalonador cooperativo de tarefas
+#include "inc/buttons.h"  // Inclui a fila de eventos dos botões (por interrupção)
+#include "inc/joystick.h"  // Inclui a amostragem contínua do joystick (ADC + DMA)
+#include "inc/metrics.h"  // Inclui as estatísticas de tempo de reação
+#include "inc/sequence.h"  // Inclui a sequência de cores compactada (2 bits por cor)
+#include "inc/session_log.h"  // Inclui o registro de partidas na flash
+#include "inc/telemetry.h"  // Inclui a telemetria binária pela USB
+#include "inc/rgb.h"  // Inclui o LED RGB em PWM com animações por DMA
+#include "inc/clips.h"  // Inclui os clipes gravados do buzzer (IMA-ADPCM na flash)
 
 // Definições dos pinos
 #define LED_RED_PIN       13    // Define o pino do LED vermelho como GPIO 13
@@ -33,473 +40,778 @@
 // Duração dos sons (em ms)
 #define NOTE_DURATION 200  // Define a duração padrão de cada nota como 200 ms
 
+// Volume dos sons (em % do ciclo do PWM)
+#define NOTE_VOLUME 30  // Define o volume em 30% (volume mais baixo)
+#define CLIP_VOLUME 80  // Volume dos clipes gravados (em % da amplitude da gravação)
+
+// Temporização das tarefas
+#define BUTTON_DEBOUNCE_US 20000   // Bordas a menos de 20 ms da última aceita são repiques
+#define JOYSTICK_POLL_US   10000   // Intervalo de classificação do joystick (10 ms)
+#define FAILURE_PAUSE_MS    2000   // Pausa após o erro para dar tempo de ler as mensagens
+#define VICTORY_SCROLL_MS   4000   // Rolagem da tela de vitória (a animação do LED dura 4,8 s)
+#define LOG_COMMIT_DELAY_MS 1000   // Espera após entrar numa pausa do jogo antes de gravar a flash
+#define LED_FADE_MS           60   // Transição suave entre as cores das animações (até metade do passo)
+#define LED_BATCH_NOTES       24   // Notas por lote de animação (a fila do buzzer tem 32)
+#ifndef IDLE_SLEEP_MS
+#define IDLE_SLEEP_MS      60000   // Tempo na tela inicial até o repouso (pode ser trocado com -DIDLE_SLEEP_MS)
+#endif
+
 // Estados das cores
 typedef enum {
     MAGENTA,  // Define o estado da cor magenta
     GREEN,    // Define o estado da cor verde
     BLUE,     // Define o estado da cor azul
     YELLOW,   // Define o estado da cor amarela
-    NUM_COLORS  // Define o número total de cores (usado para desligar os LEDs)
+    NUM_COLORS,  // Define o número total de cores (usado para desligar os LEDs)
+    ERROR_RED    // Vermelho puro, usado apenas no feedback de erro
 } ColorState;
 
-// Variáveis globais para PWM
-uint slice_num;  // Armazena o número do slice PWM usado para o buzzer
-uint channel;    // Armazena o canal PWM usado para o buzzer
+// Estados do jogo
+typedef enum {
+    GAME_IDLE,          // Aguardando o botão A
+    GAME_WELCOME,       // Mensagem de boas-vindas e animação de abertura
+    GAME_SETUP_ROUNDS,  // Escolha do número de rodadas com o joystick
+    GAME_PLAYBACK,      // Mostrando a sequência no LED
+    GAME_INPUT,         // Jogador reproduzindo a sequência
+    GAME_SUCCESS,       // Vitória: todas as rodadas completadas
+    GAME_FAILURE,       // Erro: feedback e pausa antes de recomeçar
+    GAME_SLEEP          // Repouso: display apagado e placa dormindo até o botão A
+} GameState;
+
+// Passo de uma animação do LED: cor, som opcional tocado no início e duração até o próximo passo
+typedef struct {
+    ColorState color;
+    uint32_t tone;         // Frequência do som (0 = sem som)
+    uint32_t tone_ms;
+    uint32_t duration_ms;
+} AnimationStep;
+
+// Gera o passo de número index de uma animação; retorna false quando a animação acabou
+typedef bool (*Animation)(int index, AnimationStep *step);
+
+// Estado completo do jogo
+typedef struct {
+    GameState state;
+    sequence_t sequence;             // Sequência de cores (até GENIUS_MAX_ROUNDS cores, 2 bits cada)
+    ColorState player_color;         // Cor apontada para a posição atual (NUM_COLORS = nenhuma)
+    uint64_t step_start_us;          // Início da espera pela cor atual (fim da reprodução ou confirmação anterior)
+    int failed_step;                 // Posição (a partir de 1) da cor errada na última falha
+    uint32_t failed_latency_us;      // Tempo que o jogador levou para confirmar a cor errada
+    int sequence_length;             // Tamanho atual da sequência
+    int player_index;                // Índice da sequência do jogador
+    int round;                       // Número da rodada atual
+    int max_rounds;                  // Número máximo de rodadas completadas sem errar
+    uint64_t game_start_time;        // Tempo de início do jogo
+    uint64_t deadline_us;            // Prazo usado por estados temporizados (0 = nenhum)
+} Game;
+
 
 // Variável global para o número de rodadas
 int total_rounds = 1;  // Define o número inicial de rodadas como 1
 
-// Função para acender o LED RGB com base no estado
-void set_rgb_color(ColorState color) {
+// Estado do jogo e da animação em andamento
+Game game = { .state = GAME_IDLE, .sequence_length = 1, .round = 1 };
+Animation animation = NULL;
+int animation_index = 0;
+uint64_t audio_end_us = 0;  // Fim previsto do que já está na fila do buzzer
+
+// Resumos de estatística pedidos à tarefa de estatísticas (enviados depois de incorporar as respostas)
+int metrics_report_round = 0;         // Rodada terminada (0 = nenhuma)
+bool metrics_report_session = false;  // Partida terminada
+
+// Botões e joystick
+const uint button_pins[] = { BUTTON_A_PIN, BUTTON_B_PIN };
+ColorState joystick_color = NUM_COLORS;  // Última direção lida do joystick
+
+// Identificadores das tarefas
+int button_task_id;
+int game_task_id;
+int joystick_task_id;
+int led_task_id;
+int metrics_task_id;
+int log_task_id;
+int telemetry_task_id;
+
+// Cor do LED RGB para cada estado (brilho perceptual de 0 a 255 por componente)
+rgb_color_t color_rgb(ColorState color) {
     switch (color) {
         case MAGENTA:
-            gpio_put(LED_RED_PIN, 1);   // Acende o LED vermelho
-            gpio_put(LED_GREEN_PIN, 0); // Desliga o LED verde
-            gpio_put(LED_BLUE_PIN, 1);  // Acende o LED azul (combina com vermelho para magenta)
-            break;
+            return (rgb_color_t) { 255, 0, 255 };  // Vermelho e azul
         case GREEN:
-            gpio_put(LED_RED_PIN, 0);   // Desliga o LED vermelho
-            gpio_put(LED_GREEN_PIN, 1); // Acende o LED verde
-            gpio_put(LED_BLUE_PIN, 0);  // Desliga o LED azul
-            break;
+            return (rgb_color_t) { 0, 255, 0 };
         case BLUE:
-            gpio_put(LED_RED_PIN, 0);   // Desliga o LED vermelho
-            gpio_put(LED_GREEN_PIN, 0); // Desliga o LED verde
-            gpio_put(LED_BLUE_PIN, 1);  // Acende o LED azul
-            break;
+            return (rgb_color_t) { 0, 0, 255 };
         case YELLOW:
-            gpio_put(LED_RED_PIN, 1);   // Acende o LED vermelho
-            gpio_put(LED_GREEN_PIN, 1); // Acende o LED verde (combina com vermelho para amarelo)
-            gpio_put(LED_BLUE_PIN, 0);  // Desliga o LED azul
-            break;
+            return (rgb_color_t) { 255, 255, 0 };  // Vermelho e verde
+        case ERROR_RED:
+            return (rgb_color_t) { 255, 0, 0 };
         default:
-            gpio_put(LED_RED_PIN, 0);   // Desliga todos os LEDs
-            gpio_put(LED_GREEN_PIN, 0);
-            gpio_put(LED_BLUE_PIN, 0);
-            break;
+            return (rgb_color_t) { 0, 0, 0 };  // LED apagado
     }
 }
 
-// Função para tocar um tom no buzzer
+// Função para acender o LED RGB com base no estado (interrompe a animação em andamento)
+void set_rgb_color(ColorState color) {
+    rgb_set(color_rgb(color));
+}
+
+// Função para tocar um tom no buzzer (enfileira a nota e retorna imediatamente)
 void play_tone(uint32_t frequency, uint32_t duration_ms) {
-    uint32_t clock = 125000000;  // Define o clock do sistema como 125 MHz
-    uint32_t wrap = clock / frequency;  // Calcula o valor de "wrap" para o PWM
-    pwm_config config = pwm_get_default_config();  // Obtém a configuração padrão do PWM
-    pwm_config_set_clkdiv(&config, 1.0f);  // Define o divisor de clock como 1
-    pwm_config_set_wrap(&config, wrap);  // Define o valor de "wrap" no PWM
-    pwm_init(slice_num, &config, true);  // Inicializa o PWM com a configuração
+    ui_play_tone(frequency, duration_ms, NOTE_VOLUME);
+    audio_end_us = MAX(audio_end_us, hal_time_us()) + duration_ms * 1000ull;
+}
 
-    // Define o nível do PWM para 30% (volume mais baixo)
-    pwm_set_chan_level(slice_num, channel, wrap * 0.3);
+// Toca um clipe gravado depois das notas já enfileiradas; retorna em quantos ms ele termina
+uint32_t play_clip(const audio_clip_t *clip) {
+    uint64_t now = hal_time_us();
 
-    // Mantém o som pelo tempo especificado
-    sleep_ms(duration_ms);
+    ui_play_clip(clip, CLIP_VOLUME);
+    audio_end_us = MAX(audio_end_us, now) + audio_clip_ms(clip) * 1000ull;
+    return (audio_end_us - now) / 1000;
+}
 
-    // Desliga o buzzer
-    pwm_set_chan_level(slice_num, channel, 0);
+// Silencia o buzzer e descarta as notas e o clipe enfileirados
+void stop_audio() {
+    ui_stop_audio();
+    audio_end_us = hal_time_us();
 }
 
-// Função para tocar o som correspondente à cor
-void play_color_sound(ColorState color) {
+// Função que retorna a nota correspondente à cor (0 se a cor não tiver som)
+uint32_t color_note(ColorState color) {
     switch (color) {
         case MAGENTA:
-            play_tone(NOTE_C4, NOTE_DURATION);  // Toca a nota Dó (C4)
-            break;
+            return NOTE_C4;  // Nota Dó (C4)
         case GREEN:
-            play_tone(NOTE_D4, NOTE_DURATION);  // Toca a nota Ré (D4)
-            break;
+            return NOTE_D4;  // Nota Ré (D4)
         case BLUE:
-            play_tone(NOTE_E4, NOTE_DURATION);  // Toca a nota Mi (E4)
-            break;
+            return NOTE_E4;  // Nota Mi (E4)
         case YELLOW:
-            play_tone(NOTE_F4, NOTE_DURATION);  // Toca a nota Fá (F4)
-            break;
+            return NOTE_F4;  // Nota Fá (F4)
         default:
-            break;
+            return 0;
+    }
+}
+
+// Função para tocar o som correspondente à cor
+void play_color_sound(ColorState color) {
+    uint32_t note = color_note(color);
+    if (note) {
+        play_tone(note, NOTE_DURATION);
     }
 }
 
 // Função para gerar uma sequência incremental de cores
-void generate_sequence(ColorState sequence[], int length) {
+void generate_sequence(sequence_t *sequence, int length) {
     if (length == 1) {
-        // Na primeira rodada, gera uma única cor aleatória
-        sequence[0] = rand() % NUM_COLORS;
+        // Na primeira rodada, começa uma sequência nova
+        sequence_clear(sequence);
+    }
+    // Mantém a sequência anterior e acrescenta uma nova cor aleatória ao fim
+    sequence_append(sequence, rand() % NUM_COLORS);
+}
+
+// Cor esperada numa posição da sequência do jogo (lida direto da forma compactada)
+ColorState sequence_color(int index) {
+    return (ColorState) sequence_get(&game.sequence, index);
+}
+
+// Animação que mostra a sequência de cores e sons no LED RGB
+bool sequence_animation(int index, AnimationStep *step) {
+    if (index >= 2 * game.sequence_length) {
+        return false;
+    }
+
+    if (index % 2 == 0) {
+        ColorState color = sequence_color(index / 2);
+        *step = (AnimationStep) { color, color_note(color), NOTE_DURATION, NOTE_DURATION + 500 };  // Cor durante o som e o intervalo
     } else {
-        // Nas rodadas subsequentes, mantém a sequência anterior e adiciona uma nova cor
-        sequence[length - 1] = rand() % NUM_COLORS;
+        *step = (AnimationStep) { NUM_COLORS, 0, 0, 200 };  // LED apagado entre as cores
     }
+    return true;
 }
 
-// Função para mostrar a sequência de cores e sons no LED RGB
-void show_sequence(ColorState sequence[], int length) {
-    for (int i = 0; i < length; i++) {
-        set_rgb_color(sequence[i]);  // Mostra a cor no LED RGB
-        play_color_sound(sequence[i]);  // Toca o som correspondente
-        sleep_ms(500);  // Intervalo entre as cores
-        set_rgb_color(NUM_COLORS);  // Desliga o LED RGB
-        sleep_ms(200);  // Intervalo entre as cores
+// Animação de abertura: percorre as 4 cores 2 vezes
+bool startup_animation(int index, AnimationStep *step) {
+    if (index >= 2 * 4 * 2) {
+        return false;
     }
+
+    if (index % 2 == 0) {
+        ColorState color = (index / 2) % 4;
+        *step = (AnimationStep) { color, color_note(color), NOTE_DURATION, NOTE_DURATION + 150 };
+    } else {
+        *step = (AnimationStep) { NUM_COLORS, 0, 0, 150 };
+    }
+    return true;
 }
 
-// Função para verificar a sequência do jogador
-bool check_sequence(ColorState sequence[], ColorState player_sequence[], int length) {
-    for (int i = 0; i < length; i++) {
-        if (sequence[i] != player_sequence[i]) {
-            return false;  // Sequência incorreta
-        }
+// Animação de vitória: percorre as 4 cores 3 vezes
+bool victory_animation(int index, AnimationStep *step) {
+    if (index >= 3 * 4 * 2) {
+        return false;
     }
-    return true;  // Sequência correta
+
+    if (index % 2 == 0) {
+        ColorState color = (index / 2) % 4;
+        *step = (AnimationStep) { color, color_note(color), NOTE_DURATION, NOTE_DURATION + 100 };
+    } else {
+        *step = (AnimationStep) { NUM_COLORS, 0, 0, 100 };
+    }
+    return true;
 }
 
-// Função para piscar os LEDs e tocar sons como feedback de vitória
-void victory_animation() {
-    ColorState victory_colors[] = {MAGENTA, GREEN, BLUE, YELLOW};  // Sequência de cores da vitória
-    for (int i = 0; i < 3; i++) {  // Repete a animação 3 vezes
-        for (int j = 0; j < 4; j++) {  // Percorre as 4 cores
-            set_rgb_color(victory_colors[j]);  // Mostra a cor
-            play_color_sound(victory_colors[j]);  // Toca o som correspondente
-            sleep_ms(100);  // Intervalo entre as cores (reduzido para 100 ms)
-            set_rgb_color(NUM_COLORS);  // Desliga o LED
-            sleep_ms(100);  // Intervalo entre as cores (reduzido para 100 ms)
-        }
+// Animação de erro: pisca o vermelho 3 vezes com o som de erro (Lá)
+bool error_animation(int index, AnimationStep *step) {
+    if (index >= 3 * 2) {
+        return false;
+    }
+
+    if (index % 2 == 0) {
+        *step = (AnimationStep) { ERROR_RED, NOTE_A4, 100, 100 + 100 };
+    } else {
+        *step = (AnimationStep) { NUM_COLORS, 0, 0, 100 };
     }
+    return true;
 }
 
-// Função para animação de erro
-void error_animation() {
-    for (int i = 0; i < 3; i++) {  // Repete a animação 3 vezes
-        gpio_put(LED_RED_PIN, 1);   // Acende o LED vermelho
-        gpio_put(LED_GREEN_PIN, 0); // Desliga o verde
-        gpio_put(LED_BLUE_PIN, 0);  // Desliga o azul
-        play_tone(NOTE_A4, 100);  // Toca o som de erro (Lá)
-        sleep_ms(100);  // Mantém o LED aceso por 100 ms
-        gpio_put(LED_RED_PIN, 0);   // Desliga o LED
-        sleep_ms(100);  // Intervalo entre as piscadas
+// Interrompe a animação em andamento e apaga o LED; as notas já enfileiradas do lote também param
+void stop_animation() {
+    if (animation) {
+        stop_audio();
     }
+    animation = NULL;
+    set_rgb_color(NUM_COLORS);
 }
 
-// Função para exibir mensagem no display OLED
-void display_message(char *message, int line) {
-    struct render_area frame_area = {
-        start_column: 0,
-        end_column: ssd1306_width - 1,
-        start_page: 0,
-        end_page: ssd1306_n_pages - 1
-    };
-    calculate_render_area_buffer_length(&frame_area);
+// Inicia uma animação no LED depois de delay_ms (substitui a que estiver em andamento). Até lá o
+// LED fica apagado e o jogo espera como se ela já estivesse tocando
+void start_animation_after(Animation next, uint32_t delay_ms) {
+    set_rgb_color(NUM_COLORS);
+    animation = next;
+    animation_index = 0;
+    scheduler_schedule(led_task_id, delay_ms * 1000);
+}
+
+// Inicia uma animação no LED (substitui a que estiver em andamento)
+void start_animation(Animation next) {
+    start_animation_after(next, 0);
+}
 
-    uint8_t ssd[ssd1306_buffer_length];
-    memset(ssd, 0, ssd1306_buffer_length);  // Limpa o buffer
-    ssd1306_draw_string(ssd, 5, line * 8, message);  // Desenha a mensagem
-    render_on_display(ssd, &frame_area);  // Renderiza no display
+// Função para exibir mensagem no display OLED (o serviço de display envia apenas o que mudou)
+void display_message(const char *message, int line) {
+    ui_show_message(message, line);
 }
 
 // Função para exibir duas mensagens no display OLED
-void display_two_messages(char *message1, int line1, char *message2, int line2) {
-    struct render_area frame_area = {
-        start_column: 0,
-        end_column: ssd1306_width - 1,
-        start_page: 0,
-        end_page: ssd1306_n_pages - 1
+void display_two_messages(const char *message1, int line1, const char *message2, int line2) {
+    ui_show_two_messages(message1, line1, message2, line2);
+}
+
+// Função para exibir o número de rodadas escolhido
+void display_rounds() {
+    char rounds_msg[20];
+    snprintf(rounds_msg, sizeof(rounds_msg), "Num Rodadas: %d", total_rounds);
+    display_message(rounds_msg, 3);
+    if (total_rounds <= 10) {
+        ui_show_rounds(total_rounds + 1, 10);  // Círculos cheios = rodadas escolhidas (até 10)
+    }
+}
+
+// Função para mapear a direção do joystick para as cores
+ColorState joystick_color_of(joystick_direction_t direction) {
+    switch (direction) {
+        case joystick_left:
+            return MAGENTA;  // Esquerda
+        case joystick_right:
+            return BLUE;  // Direita
+        case joystick_up:
+            return GREEN;  // Cima
+        case joystick_down:
+            return YELLOW;  // Baixo
+        default:
+            return NUM_COLORS;  // Nenhuma cor selecionada (centro)
+    }
+}
+
+// Seleciona a cor apontada pelo joystick para a posição atual do jogador
+void game_select_color(ColorState color) {
+    if (color != NUM_COLORS) {
+        set_rgb_color(color);  // Mostra a cor selecionada
+        game.player_color = color;  // Guarda a cor selecionada até a confirmação
+    }
+}
+
+// Entra em um novo estado do jogo, executando as ações de entrada
+void game_enter(GameState state) {
+    char msg[30];
+
+    game.state = state;
+    game.deadline_us = 0;
+
+    telemetry_state_t report = { state, game.round, total_rounds };
+    telemetry_emit(telemetry_state, hal_time_us(), &report, sizeof(report));
+
+    switch (state) {
+        case GAME_IDLE:
+            stop_animation();
+            display_message("Aperte Botão A", 3);  // Exibe a mensagem inicial
+            ui_start_effect(ui_effect_fade, 0, ui_contrast_default, 16, 40);  // Acende o display aos poucos
+            scheduler_schedule(log_task_id, LOG_COMMIT_DELAY_MS * 1000);  // Grava as partidas pendentes
+            game.round = 1;
+            game.sequence_length = 1;
+            game.deadline_us = hal_time_us() + IDLE_SLEEP_MS * 1000ull;  // Sem jogo, entra em repouso
+            scheduler_schedule(game_task_id, IDLE_SLEEP_MS * 1000);
+            break;
+        case GAME_WELCOME:
+            display_message("Bem-vindo!", 3);  // Exibe a mensagem de boas-vindas
+            ui_start_effect(ui_effect_pan, 32, 0, 16, 25);  // A mensagem sobe a partir do rodapé
+            start_animation(startup_animation);  // Executa a animação de abertura
+            break;
+        case GAME_SETUP_ROUNDS:
+            display_rounds();  // Ajusta o número de rodadas usando o joystick
+            break;
+        case GAME_PLAYBACK:
+            if (total_rounds <= ui_rounds_max) {
+                snprintf(msg, sizeof(msg), "Rodada %d", game.round);
+                display_message(msg, 3);  // Exibe a rodada atual no display
+                ui_show_rounds(game.round, total_rounds);  // Rodadas completadas e a atual
+            } else {
+                snprintf(msg, sizeof(msg), "Rodada %d/%d", game.round, total_rounds);
+                display_message(msg, 3);  // Sessões longas: os círculos não caberiam na tela
+            }
+            // Aviso de nova rodada e, quando ele terminar, a sequência no LED RGB
+            start_animation_after(sequence_animation, play_clip(&clip_round));
+            break;
+        case GAME_INPUT:
+            game.player_index = 0;  // Reseta o índice do jogador
+            game.player_color = NUM_COLORS;  // Nenhuma cor escolhida ainda
+            game_select_color(joystick_color);  // O joystick pode já estar inclinado
+            ui_show_progress(0, game.sequence_length);  // Barra de cores confirmadas
+            game.step_start_us = hal_time_us();
+            metrics_playback_end(game.step_start_us);  // O tempo de reação conta a partir daqui
+            break;
+        case GAME_SUCCESS:
+            display_two_messages("Você venceu!", 3, "Parabéns!", 4);  // Exibe as mensagens de vitória
+            ui_start_effect(ui_effect_diagonal, 3, 4, 1, VICTORY_SCROLL_MS);  // O próprio display rola as mensagens
+            start_animation_after(victory_animation, play_clip(&clip_victory));  // Animação de vitória com sons
+            break;
+        case GAME_FAILURE:
+            // Exibe a mensagem de erro e o número máximo de rodadas (0 se for a primeira rodada)
+            snprintf(msg, sizeof(msg), "Rodadas: %d", (game.round == 1) ? 0 : game.max_rounds);
+            display_two_messages("Incorreto!", 3, msg, 4);
+            // Onde e quando o jogador errou (o relatório completo vai para a serial)
+            snprintf(msg, sizeof(msg), "Passo %d: %lu,%lus", game.failed_step,
+                     (unsigned long) (game.failed_latency_us / 1000000),
+                     (unsigned long) (game.failed_latency_us / 100000 % 10));
+            ui_show_line(msg, 6);
+            ui_start_effect(ui_effect_flash, 0, 0, 6, 100);  // Pisca a tela junto com o LED vermelho
+            start_animation(error_animation);  // Executa a animação de erro
+            break;
+        case GAME_SLEEP:
+            // Nada pode ficar só na RAM: as partidas pendentes vão para a flash antes de dormir
+            session_log_flush();
+            ui_set_power(false);  // Apaga o display e para o PWM do buzzer e do LED (o painel guarda a imagem)
+            joystick_enable(false);  // Para o ADC e a leitura periódica do joystick
+            scheduler_suspend(joystick_task_id);
+            scheduler_wake(game_task_id);  // Dorme assim que o núcleo 1 terminar de apagar o display
+            break;
+    }
+}
+
+// Sai do repouso pelo botão A: o joystick volta a ser lido e o display religa já com a tela inicial
+void game_wake() {
+    joystick_enable(true);
+    scheduler_schedule(joystick_task_id, JOYSTICK_POLL_US);
+    game_enter(GAME_IDLE);  // Mesma tela de antes: nada a reenviar, só o fade
+    ui_set_power(true);
+}
+
+// Começa uma partida com o número de rodadas escolhido
+void game_start() {
+    game.round = 1;
+    game.sequence_length = 1;
+    game.max_rounds = 0;  // Reinicia o número máximo de rodadas completadas
+    game.game_start_time = hal_time_us();  // Armazena o tempo de início do jogo
+    metrics_reset(game.game_start_time);  // Nova sessão de estatísticas
+    generate_sequence(&game.sequence, game.sequence_length);  // Gera a sequência inicial
+    game_enter(GAME_PLAYBACK);
+}
+
+// Guarda o resultado da partida na fila do registro; a gravação na flash fica para uma pausa do jogo
+void log_session(int failed_step) {
+    session_log_record_t record = {
+        .duration_ms = (hal_time_us() - game.game_start_time) / 1000,
+        .total_rounds = total_rounds,
+        .max_rounds = game.max_rounds,
+        .failed_step = failed_step,
     };
-    calculate_render_area_buffer_length(&frame_area);
 
-    uint8_t ssd[ssd1306_buffer_length];
-    memset(ssd, 0, ssd1306_buffer_length);  // Limpa o buffer
+    session_log_add(&record);
+    telemetry_emit(telemetry_session, hal_time_us(), &record, sizeof(record));  // Já com número e CRC
+    metrics_report_session = true;
+    scheduler_wake(metrics_task_id);
+}
+
+// Erro do jogador: a rodada termina na hora, sem esperar o restante da sequência. Passo e tempo vão
+// para a tela de erro e o quadro telemetry_step já enviado (esperada != escolhida); nada de printf
+// aqui, que com a USB lenta travaria a entrada
+void game_fail_input(uint64_t timestamp_us) {
+    game.failed_step = game.player_index + 1;
+    game.failed_latency_us = timestamp_us - game.step_start_us;
+    metrics_report_round = game.round;
+    log_session(game.failed_step);
+    game_enter(GAME_FAILURE);
+    // A pausa após o erro não tem jogada: grava depois que o efeito de erro terminar
+    scheduler_schedule(log_task_id, LOG_COMMIT_DELAY_MS * 1000);
+}
 
-    // Desenha a primeira mensagem
-    ssd1306_draw_string(ssd, 5, line1 * 8, message1);
+// Sequência completa e correta: avança para a próxima rodada ou termina com vitória
+void game_finish_input() {
+    metrics_report_round = game.round;
 
-    // Desenha a segunda mensagem
-    ssd1306_draw_string(ssd, 5, line2 * 8, message2);
+    // Atualiza o número máximo de rodadas completadas
+    if (game.round > game.max_rounds) {
+        game.max_rounds = game.round;
+    }
 
-    // Renderiza as duas mensagens no display
-    render_on_display(ssd, &frame_area);
+    // Avança para a próxima rodada
+    game.round++;
+    if (game.round > total_rounds) {  // Usa o número de rodadas escolhido
+        log_session(0);  // Gravada quando o jogo voltar à tela inicial
+        game_enter(GAME_SUCCESS);
+    } else {
+        // Aumenta a dificuldade (adiciona uma nova cor à sequência)
+        game.sequence_length++;
+        generate_sequence(&game.sequence, game.sequence_length);
+        game_enter(GAME_PLAYBACK);
+    }
 }
 
-void startup_animation() {
-    ColorState startup_colors[] = {MAGENTA, GREEN, BLUE, YELLOW};  // Sequência de cores da animação
-    for (int i = 0; i < 2; i++) {  // Repete a animação 2 vezes
-        for (int j = 0; j < 4; j++) {  // Percorre as 4 cores
-            set_rgb_color(startup_colors[j]);  // Mostra a cor
-            play_color_sound(startup_colors[j]);  // Toca o som correspondente
-            sleep_ms(150);  // Intervalo entre as cores (150 ms)
-            set_rgb_color(NUM_COLORS);  // Desliga o LED
-            sleep_ms(150);  // Intervalo entre as cores (150 ms)
+// Trata o pressionamento (já filtrado) de um botão
+void game_on_button(const button_event_t *event) {
+    ColorState expected;
+    telemetry_step_t step;
+
+    if (event->pin == BUTTON_A_PIN) {
+        if (game.state == GAME_SLEEP) {
+            game_wake();  // Repouso sem modo dormente (USB conectada): o pressionamento chega normalmente
+            return;
         }
+        // Botão A liga/desliga o jogo a qualquer momento
+        game_enter(game.state == GAME_IDLE ? GAME_WELCOME : GAME_IDLE);
+        return;
     }
-}
 
-// Função para ler a cor selecionada pelo joystick
-ColorState read_joystick_color() {
-    adc_select_input(0);  // Seleciona o canal ADC0 (eixo X, GPIO 26)
-    uint16_t x_value = adc_read();  // Lê o valor do eixo X
-    adc_select_input(1);  // Seleciona o canal ADC1 (eixo Y, GPIO 27)
-    uint16_t y_value = adc_read();  // Lê o valor do eixo Y
-    adc_select_input(0);  // Volta ao canal ADC0 (eixo X, GPIO 26)
-
-    // Mapeia os valores do joystick para as cores
-    if (x_value < 1000) {
-        return MAGENTA;  // Esquerda
-    } else if (x_value > 3000) {
-        return BLUE;  // Direita
-    } else if (y_value > 3000) {
-        return GREEN;  // Cima
-    } else if (y_value < 1000) {
-        return YELLOW; // Baixo
-    } else {
-        return NUM_COLORS;  // Nenhuma cor selecionada (centro)
+    switch (game.state) {
+        case GAME_SETUP_ROUNDS:
+            game_start();  // Botão B confirma o número de rodadas
+            break;
+        case GAME_INPUT:
+            // Botão B confirma a cor selecionada, toca o som correspondente e a compara com a sequência
+            expected = sequence_color(game.player_index);
+            play_color_sound(game.player_color);
+            // Registra o tempo de reação pelo instante da interrupção; o cálculo fica para metrics_task
+            metrics_input(expected, game.round, event->timestamp_us, game.player_color == expected);
+            scheduler_wake(metrics_task_id);
+            // Envia a resposta pela telemetria com o mesmo instante da interrupção
+            step.round = game.round;
+            step.step = game.player_index + 1;
+            step.expected = expected;
+            step.chosen = game.player_color;
+            step.latency_us = event->timestamp_us - game.step_start_us;
+            telemetry_emit(telemetry_step, event->timestamp_us, &step, sizeof(step));
+            if (game.player_color != expected) {
+                game_fail_input(event->timestamp_us);  // Primeira cor errada encerra a rodada
+                break;
+            }
+            game.step_start_us = event->timestamp_us;
+            game.player_index++;  // Avança para a próxima cor
+            ui_show_progress(game.player_index, game.sequence_length);
+            if (game.player_index >= game.sequence_length) {
+                game_finish_input();
+            } else {
+                game.player_color = NUM_COLORS;
+                game_select_color(joystick_color);  // Mantém a cor se o joystick continuar inclinado
+            }
+            break;
+        default:
+            break;
     }
 }
 
-// Função para ajustar o número de rodadas usando o joystick
-void adjust_rounds() {
-    char rounds_msg[20];
-    int last_x_value = adc_read();  // Lê o valor inicial do eixo X
+// Trata uma mudança de direção do joystick
+void game_on_joystick(ColorState color) {
+    switch (game.state) {
+        case GAME_SETUP_ROUNDS:
+            if (color == BLUE) {
+                total_rounds++;  // Direita: incrementa o número de rodadas
+            } else if (color == MAGENTA) {
+                total_rounds--;  // Esquerda: decrementa o número de rodadas
+            } else if (color == GREEN) {
+                total_rounds += 10;  // Cima: dez rodadas a mais (sessões longas)
+            } else if (color == YELLOW) {
+                total_rounds -= 10;  // Baixo: dez rodadas a menos
+            }
+            total_rounds = MAX(1, MIN(total_rounds, GENIUS_MAX_ROUNDS));
+            display_rounds();
+            break;
+        case GAME_INPUT:
+            game_select_color(color);
+            break;
+        default:
+            break;
+    }
+}
 
-    while (true) {
-        // Lê o valor do eixo X do joystick
-        adc_select_input(0);  // Seleciona o canal ADC0 (eixo X, GPIO 26)
-        uint16_t x_value = adc_read();  // Lê o valor do eixo X
+// Tarefa do jogo: acordada no fim das animações e nos prazos dos estados temporizados
+void game_task() {
+    if (animation) {
+        return;  // Ainda há animação em andamento
+    }
 
-        // Verifica se o joystick foi movido para a direita (aumentar rodadas)
-        if (x_value > 3000 && last_x_value <= 3000) {
-            if (total_rounds < 10) {
-                total_rounds++;  // Incrementa o número de rodadas
+    switch (game.state) {
+        case GAME_WELCOME:
+            game_enter(GAME_SETUP_ROUNDS);
+            break;
+        case GAME_PLAYBACK:
+            game_enter(GAME_INPUT);
+            break;
+        case GAME_SUCCESS:
+            game_enter(GAME_IDLE);  // Desliga o LED e volta à mensagem inicial
+            break;
+        case GAME_IDLE:
+            if (game.deadline_us && hal_time_us() >= game.deadline_us) {
+                game_enter(GAME_SLEEP);  // Ninguém apertou o botão A: economiza a bateria
             }
-        }
-        // Verifica se o joystick foi movido para a esquerda (diminuir rodadas)
-        else if (x_value < 1000 && last_x_value >= 1000) {
-            if (total_rounds > 1) {
-                total_rounds--;  // Decrementa o número de rodadas
+            break;
+        case GAME_SLEEP:
+            if (!ui_sleeping()) {
+                scheduler_schedule(game_task_id, 1000);  // O display ainda está sendo desligado
+            } else {
+                // Dorme até o botão A. A borda que acorda do modo dormente não chega como interrupção do
+                // botão: o despertar é feito aqui, e o filtro do botão passa a considerá-la a última borda
+                // aceita (senão um repique da soltura viraria um novo pressionamento). Com a USB em uso a
+                // placa não dorme e fica só em WFE, com display e ADC parados; aí o pressionamento chega
+                // normalmente a game_on_button()
+                if (hal_dormant_until_edge(BUTTON_A_PIN)) {
+                    buttons_resync(BUTTON_A_PIN, true, hal_time_us());
+                    game_wake();
+                }
             }
-        }
+            break;
+        case GAME_FAILURE:
+            if (game.deadline_us == 0) {
+                // Aguarda para dar tempo de ler as mensagens
+                game.deadline_us = hal_time_us() + FAILURE_PAUSE_MS * 1000;
+                scheduler_schedule(game_task_id, FAILURE_PAUSE_MS * 1000);
+            } else if (hal_time_us() >= game.deadline_us) {
+                // Reinicia o jogo a partir da primeira rodada
+                game.round = 1;
+                game.sequence_length = 1;
+                generate_sequence(&game.sequence, game.sequence_length);
+                game_enter(GAME_PLAYBACK);
+            }
+            break;
+        default:
+            break;
+    }
+}
 
-        // Atualiza o último valor lido do eixo X
-        last_x_value = x_value;
+// Tarefa do LED: monta um lote de passos da animação (cores para o DMA, notas para a fila do
+// buzzer), dispara tudo junto e só volta no fim do lote. As animações fixas cabem num lote só;
+// a sequência do jogo, que cresce a cada rodada, pode precisar de vários
+void led_task() {
+    AnimationStep step;
+    uint32_t batch_ms = 0;
+    uint32_t pause_ms = 0;  // Silêncio ainda não enfileirado desde a última nota
+    int notes = 0;
+
+    if (!animation) {
+        return;
+    }
 
-        // Exibe o número de rodadas no display OLED
-        snprintf(rounds_msg, sizeof(rounds_msg), "Num Rodadas: %d", total_rounds);
-        display_message(rounds_msg, 3);
+    rgb_begin();
+    while (animation(animation_index, &step)) {
+        int needed = step.tone ? 1 + (pause_ms > 0) : 0;  // A nota e o silêncio antes dela
+        uint32_t fade_ms = MIN(LED_FADE_MS, step.duration_ms / 2);
+        if (notes + needed > LED_BATCH_NOTES || !rgb_add(color_rgb(step.color), fade_ms, step.duration_ms)) {
+            break;  // A fila de notas ou a tabela de quadros encheu: o passo fica para o próximo lote
+        }
+        animation_index++;
 
-        // Verifica se o botão B foi pressionado para confirmar
-        if (!gpio_get(BUTTON_B_PIN)) {
-            sleep_ms(20);  // Debounce simples
-            if (!gpio_get(BUTTON_B_PIN)) {  // Confirma o pressionamento
-                return;  // Retorna ao jogo
+        if (step.tone) {
+            if (pause_ms) {
+                play_tone(0, pause_ms);
+                notes++;
             }
+            play_tone(step.tone, step.tone_ms);
+            notes++;
+            pause_ms = step.duration_ms - step.tone_ms;
+        } else {
+            pause_ms += step.duration_ms;
         }
+        batch_ms += step.duration_ms;
+    }
 
-        sleep_ms(100);  // Pequeno delay para evitar leituras muito rápidas
+    if (batch_ms == 0) {
+        animation = NULL;
+        set_rgb_color(NUM_COLORS);
+        scheduler_wake(game_task_id);  // Avisa o jogo que a animação terminou
+        return;
     }
+
+    rgb_play();
+    scheduler_schedule(led_task_id, batch_ms * 1000);
 }
 
-// Função principal
-int main() {
-    stdio_init_all();  // Inicializa a comunicação serial
-
-    // Configura os pinos
-    gpio_init(LED_RED_PIN);
-    gpio_init(LED_GREEN_PIN);
-    gpio_init(LED_BLUE_PIN);
-    gpio_init(BUTTON_A_PIN);
-    gpio_init(BUTTON_B_PIN);
-    gpio_set_dir(LED_RED_PIN, GPIO_OUT);
-    gpio_set_dir(LED_GREEN_PIN, GPIO_OUT);
-    gpio_set_dir(LED_BLUE_PIN, GPIO_OUT);
-    gpio_set_dir(BUTTON_A_PIN, GPIO_IN);
-    gpio_set_dir(BUTTON_B_PIN, GPIO_IN);
-    gpio_pull_up(BUTTON_A_PIN);  // Habilita resistor pull-up no botão A
-    gpio_pull_up(BUTTON_B_PIN);  // Habilita resistor pull-up no botão B
-
-    // Configura o PWM para o buzzer
-    gpio_set_function(BUZZER_PIN, GPIO_FUNC_PWM);
-    slice_num = pwm_gpio_to_slice_num(BUZZER_PIN);
-    channel = pwm_gpio_to_channel(BUZZER_PIN);
-
-    // Configura o ADC para leitura do joystick
-    adc_init();
-    adc_gpio_init(JOYSTICK_X_PIN);  // Configura GPIO 26 como entrada analógica
-    adc_gpio_init(JOYSTICK_Y_PIN);  // Configura GPIO 27 como entrada analógica
-    adc_select_input(0);            // Seleciona o canal ADC0 (GPIO 26)
+// Chamada pela interrupção dos botões quando há evento novo na fila
+void button_notify() {
+    scheduler_wake(button_task_id);
+}
 
-    // Configura o I2C para o display OLED
-    i2c_init(i2c1, ssd1306_i2c_clock * 1000);
-    gpio_set_function(I2C_SDA, GPIO_FUNC_I2C);
-    gpio_set_function(I2C_SCL, GPIO_FUNC_I2C);
-    gpio_pull_up(I2C_SDA);
-    gpio_pull_up(I2C_SCL);
+// Tarefa dos botões: consome a fila de eventos e repassa os pressionamentos ao jogo
+void button_task() {
+    button_event_t event;
 
-    // Inicializa o display OLED
-    ssd1306_init();
+    // Reavalia o nível dos botões ao fim de cada janela de debounce
+    uint64_t window_end = buttons_settle();
+    if (window_end) {
+        scheduler_schedule(button_task_id, window_end - hal_time_us());
+    }
 
-    // Exibe a mensagem inicial
-    display_message("Aperte Botao A", 3);
+    while (buttons_pop(&event)) {
+        if (event.pressed) {
+            game_on_button(&event);
+        }
+    }
+}
 
-    // Configura a semente do gerador de números aleatórios
-    srand(time_us_64());
-
-    // Variáveis do jogo
-    bool game_active = false;  // Estado do jogo (ligado/desligado)
-    ColorState sequence[10];  // Sequência de cores (máximo de 10 cores)
-    ColorState player_sequence[10];  // Sequência do jogador
-    int sequence_length = 1;  // Tamanho inicial da sequência
-    int player_index = 0;  // Índice da sequência do jogador
-    int round = 1;  // Número da rodada atual
-    int max_rounds = 0;  // Número máximo de rodadas completadas sem errar
-    uint64_t game_start_time = 0;  // Tempo de início do jogo
-
-    while (true) {
-        // Verifica se o botão A foi pressionado (liga/desliga o jogo)
-        if (!gpio_get(BUTTON_A_PIN)) {
-            sleep_ms(20);  // Debounce simples
-            if (!gpio_get(BUTTON_A_PIN)) {  // Confirma o pressionamento
-                if (!game_active) {
-                    // Inicia o jogo
-                    game_active = true;
-                    
-                    // Exibe a mensagem de boas-vindas
-                    display_message("Bem-vindo!", 3);
-
-                    // Executa a animação de abertura
-                    startup_animation();
-
-                    // Ajusta o número de rodadas usando o joystick
-                    adjust_rounds();
-                    
-                    // Gera a sequência inicial
-                    generate_sequence(sequence, sequence_length);
-
-                    // Armazena o tempo de início do jogo
-                    game_start_time = time_us_64();
-
-                    // Reinicia o número máximo de rodadas completadas
-                    max_rounds = 0;
-                } else {
-                    // Desliga o jogo
-                    game_active = false;
-                    
-
-                    // Exibe a mensagem inicial
-                    display_message("Aperte Botao A", 3);
-
-                    // Reinicia as variáveis do jogo
-                    round = 1;
-                    sequence_length = 1;
-                    set_rgb_color(NUM_COLORS);  // Desliga o LED
-                }
+// Tempo para o quadro de resumo: microssegundos em ms, saturado
+uint16_t summary_ms(float us) {
+    return us >= UINT16_MAX * 1000.0f ? UINT16_MAX : (uint16_t) (us / 1000 + 0.5f);
+}
+
+// Envia o resumo de um grupo de respostas; uma rodada só tem stats (summary = NULL)
+void report_summary(uint8_t scope, uint16_t index, const metrics_stats_t *stats, const metrics_summary_t *summary) {
+    telemetry_summary_t report = {
+        .scope = scope,
+        .index = index,
+        .count = MIN(stats->count, UINT16_MAX),
+        .errors = summary ? MIN(summary->errors, UINT16_MAX) : 0,
+        .mean_ms = summary_ms(stats->mean),
+        .stddev_ms = summary_ms(sqrtf(metrics_variance(stats))),
+        .min_ms = stats->count ? summary_ms(stats->min_us) : 0,
+        .max_ms = summary_ms(stats->max_us),
+        .median_ms = summary ? summary_ms(metrics_quantile(&summary->median)) : 0,
+        .p90_ms = summary ? summary_ms(metrics_quantile(&summary->p90)) : 0,
+    };
+    telemetry_emit(telemetry_summary, hal_time_us(), &report, sizeof(report));
+}
+
+// Tarefa de estatísticas: incorpora as respostas registradas (prioridade mais baixa) e envia os resumos
+// pedidos: o da rodada ao fim de cada uma; o da partida, o de cada cor e o histograma ao fim da partida
+void metrics_task() {
+    metrics_process();
 
-                while (!gpio_get(BUTTON_A_PIN));  // Aguarda o botão ser solto
+    if (metrics_report_round) {
+        report_summary(telemetry_summary_round, metrics_report_round, metrics_round(metrics_report_round), NULL);
+        metrics_report_round = 0;
+    }
+    if (metrics_report_session) {
+        const metrics_summary_t *overall = metrics_overall();
+        telemetry_histogram_t histogram;
+
+        report_summary(telemetry_summary_session, 0, &overall->stats, overall);
+        for (uint8_t color = 0; color < metrics_colors; color++) {
+            const metrics_summary_t *summary = metrics_color(color);
+            if (summary->stats.count) {
+                report_summary(telemetry_summary_color, color, &summary->stats, summary);
             }
         }
+        for (uint i = 0; i < count_of(histogram.bins); i++) {
+            histogram.bins[i] = i < metrics_histogram_bins ? MIN(overall->histogram[i], UINT8_MAX) : 0;
+        }
+        telemetry_emit(telemetry_histogram, hal_time_us(), &histogram, sizeof(histogram));
+        metrics_report_session = false;
+    }
+}
 
-        // Se o jogo estiver ativo, executa o loop do jogo
-        if (game_active) {
-           
-            char round_msg[20];
-            snprintf(round_msg, sizeof(round_msg), "Rodada %d", round);
-            display_message(round_msg, 3);  // Exibe a rodada atual no display
-
-            // Mostra a sequência para o jogador no LED RGB
-            show_sequence(sequence, sequence_length);
-
-            // Reseta o índice do jogador
-            player_index = 0;
-
-            // Loop para capturar a sequência do jogador
-            while (player_index < sequence_length) {
-                // Verifica se o botão A foi pressionado (desliga o jogo)
-                if (!gpio_get(BUTTON_A_PIN)) {
-                    sleep_ms(20);  // Debounce simples
-                    if (!gpio_get(BUTTON_A_PIN)) {  // Confirma o pressionamento
-                        game_active = false;  // Desliga o jogo
-                        
-                        // Exibe a mensagem inicial
-                        display_message("Aperte Botao A", 3);
-
-                        // Reinicia as variáveis do jogo
-                        round = 1;
-                        sequence_length = 1;
-                        set_rgb_color(NUM_COLORS);  // Desliga o LED
-                        while (!gpio_get(BUTTON_A_PIN));  // Aguarda o botão ser solto
-                        break;  // Sai do loop de captura da sequência
-                    }
-                }
+// Tarefa do registro: grava as páginas completas de partidas somente nas pausas do jogo, pois apagar e
+// gravar a flash param a execução (e o núcleo 1) por dezenas de milissegundos
+void log_task() {
+    if (session_log_pending() && (game.state == GAME_IDLE || game.state == GAME_FAILURE)) {
+        session_log_commit();
+    }
+}
 
-                // Lê a cor selecionada pelo joystick
-                ColorState selected_color = read_joystick_color();
-                if (selected_color != NUM_COLORS) {
-                    set_rgb_color(selected_color);  // Mostra a cor selecionada
-                    player_sequence[player_index] = selected_color;  // Armazena a cor selecionada
-                }
+// Chamada pela telemetria quando há quadros novos no anel
+void telemetry_notify() {
+    scheduler_wake(telemetry_task_id);
+}
 
-                // Verifica se o botão B foi pressionado (confirmar cor)
-                if (!gpio_get(BUTTON_B_PIN)) {
-                    // Toca o som da cor selecionada
-                    play_color_sound(player_sequence[player_index]);
+// Tarefa da telemetria: envia à USB o que couber agora; com o host atrasado, tenta de novo mais tarde.
+// Sem terminal aberto nada sai: os quadros ficam no anel (os que não couberem são contados como
+// descartados) e a tarefa só confere a conexão a cada telemetry_poll_us, para não acordar a CPU à toa
+void telemetry_task() {
+    if (telemetry_drain()) {
+        scheduler_schedule(telemetry_task_id, hal_usb_connected() ? telemetry_retry_us : telemetry_poll_us);
+    }
+}
 
-                    player_index++;  // Avança para a próxima cor
-                    sleep_ms(200);  // Debounce
-                    while (!gpio_get(BUTTON_B_PIN));  // Aguarda o botão ser solto
-                }
-            }
+// Tarefa do joystick: classifica as amostras já coletadas pelo DMA e gera um evento quando a direção muda
+void joystick_task() {
+    joystick_direction_t direction;
 
-            // Se o jogo foi interrompido, sai do loop do jogo
-            if (!game_active) {
-                continue;
-            }
+    if (joystick_poll(&direction)) {
+        joystick_color = joystick_color_of(direction);
+        uint8_t color = joystick_color;
+        telemetry_emit(telemetry_joystick, hal_time_us(), &color, sizeof(color));
+        game_on_joystick(joystick_color);
+    }
+}
 
-            // Verifica se a sequência do jogador está correta
-            if (check_sequence(sequence, player_sequence, sequence_length)) {
-                
-                
-                // Atualiza o número máximo de rodadas completadas
-                if (round > max_rounds) {
-                    max_rounds = round;
-                }
+// Função principal
+int main() {
+    hal_init();  // Inicializa a comunicação serial
 
-                // Avança para a próxima rodada
-                round++;
-                if (round > total_rounds) {  // Usa o número de rodadas escolhido
-                    // Exibe as mensagens de vitória
-                    display_two_messages("Voce venceu!", 3, "Parabens!", 4);
-
-                    // Animação de vitória com sons
-                    victory_animation();
-
-                    // Desliga o LED
-                    set_rgb_color(NUM_COLORS);
-
-                    // Reinicia o jogo
-                    game_active = false;
-                    display_message("Aperte Botao A", 3);  // Exibe a mensagem inicial
-                    round = 1;
-                    sequence_length = 1;
-                } else {
-                    // Aumenta a dificuldade (adiciona uma nova cor à sequência)
-                    sequence_length++;
-                    generate_sequence(sequence, sequence_length);  // Gera uma nova sequência
-                }
-            } else {
-               
-                // Exibe a mensagem de erro e o número máximo de rodadas
-                char error_msg[30];
-                snprintf(error_msg, sizeof(error_msg), "Rodadas: %d", (round == 1) ? 0 : max_rounds);  // Mostra 0 se for a primeira rodada
-                display_two_messages("incorreto!", 3, error_msg, 4);
-
-                // Executa a animação de erro
-                error_animation();
-
-                // Aguarda 2 segundos para dar tempo de ler as mensagens
-                sleep_ms(2000);
-
-                // Reinicia o jogo
-                round = 1;
-                sequence_length = 1;
-                generate_sequence(sequence, sequence_length);  // Gera uma nova sequência
-            }
-        }
-    }
+    // Configura o LED RGB em PWM (antes do buzzer, que divide um slice com o LED verde)
+    rgb_init(LED_RED_PIN, LED_GREEN_PIN, LED_BLUE_PIN);
+
+    // Configura o ADC para amostrar os dois eixos do joystick continuamente (GPIO 26 e 27)
+    joystick_init(JOYSTICK_X_PIN, JOYSTICK_Y_PIN);
+
+    // Configura o I2C para o display OLED
+    hal_i2c_init(ssd1306_i2c_bus, I2C_SDA, I2C_SCL, ssd1306_i2c_clock * 1000);
+
+    // Inicializa o display OLED e o buzzer (PWM) no núcleo que vai atendê-los
+    ui_init(BUZZER_PIN);
+
+    // Configura a semente do gerador de números aleatórios
+    srand(hal_time_us());
+
+    // Localiza o fim do registro de partidas gravado na flash
+    session_log_init();
+    printf("Registro: %u partidas na flash\n", session_log_count());
+
+    // Registra as tarefas: as periódicas leem as entradas, as demais rodam quando acordadas
+    button_task_id = scheduler_add_task(button_task, 0);
+    joystick_task_id = scheduler_add_task(joystick_task, JOYSTICK_POLL_US);
+    game_task_id = scheduler_add_task(game_task, 0);
+    led_task_id = scheduler_add_task(led_task, 0);
+    log_task_id = scheduler_add_task(log_task, 0);
+    metrics_task_id = scheduler_add_task(metrics_task, 0);  // Prioridade baixa: só roda depois das demais
+    telemetry_task_id = scheduler_add_task(telemetry_task, 0);  // Envio à USB: sobra de tempo, sem pressa
+    telemetry_init(telemetry_notify);
+
+    // Botões A e B com pull-up, lidos por interrupção de borda
+    buttons_init(button_pins, count_of(button_pins), BUTTON_DEBOUNCE_US, button_notify);
+
+    telemetry_boot_t boot = { telemetry_version, session_log_count() };
+    telemetry_emit(telemetry_boot, hal_time_us(), &boot, sizeof(boot));
+
+    // Exibe a mensagem inicial e entrega o controle ao escalonador
+    game_enter(GAME_IDLE);
+    scheduler_run();
 
     return 0;
 }
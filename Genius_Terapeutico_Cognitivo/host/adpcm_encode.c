@@ -0,0 +1,226 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "inc/adpcm.h"
+
+// Gera os clipes do buzzer (audio_clip_t) em IMA-ADPCM. Cada argumento depois da saída é
+// nome=fonte, onde a fonte é um WAV PCM de 16 bits mono a 8-16 kHz (gravações de voz) ou
+// "tom:freq/ms,freq/ms,..." (notas senoidais com decaimento, a 8 kHz). Escreve <saída>.c e
+// <saída>.h e imprime o tamanho e a relação sinal/ruído de cada clipe:
+//
+//   adpcm_encode inc/clips clip_round=tom:1047/90,1568/160 clip_voz=rodada.wav
+
+#define encode_tone_rate 8000      // Taxa dos clipes sintetizados
+#define encode_tone_attack_ms 4    // Subida de cada nota (sem estalo)
+#define encode_tone_amplitude 24000
+#define encode_max_clips 16
+
+typedef struct {
+    char name[64];
+    int16_t *samples;
+    uint32_t count;
+    uint32_t rate;
+} encode_clip_t;
+
+static encode_clip_t encode_clips[encode_max_clips];
+
+static uint32_t encode_le(const uint8_t *bytes, uint length) {
+    uint32_t value = 0;
+
+    for (uint i = 0; i < length; i++) {
+        value |= (uint32_t) bytes[i] << (8 * i);
+    }
+    return value;
+}
+
+// Lê os blocos "fmt " e "data" de um WAV; só PCM de 16 bits mono
+static bool encode_read_wav(const char *path, encode_clip_t *clip) {
+    FILE *file = fopen(path, "rb");
+    uint8_t header[12];
+    uint8_t chunk[8];
+    bool format_ok = false;
+
+    if (!file) {
+        perror(path);
+        return false;
+    }
+    if (fread(header, 1, 12, file) != 12 || memcmp(header, "RIFF", 4) || memcmp(&header[8], "WAVE", 4)) {
+        fprintf(stderr, "%s: não é um WAV\n", path);
+        fclose(file);
+        return false;
+    }
+
+    while (fread(chunk, 1, 8, file) == 8) {
+        uint32_t size = encode_le(&chunk[4], 4);
+        if (!memcmp(chunk, "fmt ", 4)) {
+            uint8_t format[16];
+            if (size < 16 || fread(format, 1, 16, file) != 16) {
+                break;
+            }
+            fseek(file, size - 16 + (size & 1), SEEK_CUR);
+            clip->rate = encode_le(&format[4], 4);
+            format_ok = encode_le(&format[0], 2) == 1 && encode_le(&format[2], 2) == 1 &&
+                        encode_le(&format[14], 2) == 16;
+        } else if (!memcmp(chunk, "data", 4) && format_ok) {
+            clip->count = size / 2;
+            clip->samples = malloc(clip->count * sizeof(int16_t));
+            for (uint32_t i = 0; i < clip->count; i++) {
+                uint8_t sample[2];
+                if (fread(sample, 1, 2, file) != 2) {
+                    clip->count = i;
+                    break;
+                }
+                clip->samples[i] = (int16_t) encode_le(sample, 2);
+            }
+            fclose(file);
+            if (clip->rate < 8000 || clip->rate > 16000) {
+                fprintf(stderr, "%s: taxa de %lu Hz fora de 8-16 kHz\n", path, (unsigned long) clip->rate);
+                return false;
+            }
+            return true;
+        } else {
+            fseek(file, size + (size & 1), SEEK_CUR);
+        }
+    }
+
+    fprintf(stderr, "%s: esperado PCM de 16 bits mono\n", path);
+    fclose(file);
+    return false;
+}
+
+// Notas em sequência, cada uma com subida curta e decaimento exponencial até o fim da sua duração
+static bool encode_tone(const char *spec, encode_clip_t *clip) {
+    uint32_t capacity = 0;
+
+    clip->rate = encode_tone_rate;
+    clip->count = 0;
+    clip->samples = NULL;
+
+    while (*spec) {
+        char *end;
+        double frequency = strtod(spec, &end);
+        if (end == spec || *end != '/') {
+            return false;
+        }
+        double duration_ms = strtod(end + 1, &end);
+        if (duration_ms <= 0 || (*end && *end != ',')) {
+            return false;
+        }
+        spec = *end ? end + 1 : end;
+
+        uint32_t count = (uint32_t) (duration_ms * clip->rate / 1000);
+        uint32_t attack = encode_tone_attack_ms * clip->rate / 1000;
+        if (clip->count + count > capacity) {
+            capacity = (clip->count + count) * 2;
+            clip->samples = realloc(clip->samples, capacity * sizeof(int16_t));
+        }
+        for (uint32_t i = 0; i < count; i++) {
+            double envelope = i < attack ? (double) i / attack : exp(-4.0 * (i - attack) / count);
+            double phase = 2 * M_PI * frequency * i / clip->rate;
+            clip->samples[clip->count + i] = (int16_t) (encode_tone_amplitude * envelope * sin(phase));
+        }
+        clip->count += count;
+    }
+    return clip->count > 0;
+}
+
+// Codifica o clipe e devolve a relação sinal/ruído (dB) do que o decodificador vai reconstruir
+static double encode_clip(const encode_clip_t *clip, uint8_t *data) {
+    adpcm_state_t encoder = { 0, 0 };
+    adpcm_state_t decoder = { 0, 0 };
+    double signal = 0;
+    double noise = 0;
+
+    memset(data, 0, (clip->count + 1) / 2);
+    for (uint32_t i = 0; i < clip->count; i++) {
+        uint8_t nibble = adpcm_encode(&encoder, clip->samples[i]);
+        data[i / 2] |= nibble << (4 * (i & 1));
+
+        double error = clip->samples[i] - adpcm_decode(&decoder, nibble);
+        signal += (double) clip->samples[i] * clip->samples[i];
+        noise += error * error;
+    }
+    return noise > 0 ? 10 * log10(signal / noise) : 99;
+}
+
+int main(int argc, char **argv) {
+    char path[256];
+    uint clips = 0;
+
+    if (argc < 3 || argc - 2 > encode_max_clips) {
+        fprintf(stderr, "uso: %s <saída sem extensão> nome=arquivo.wav|nome=tom:freq/ms,... ...\n", argv[0]);
+        return 2;
+    }
+
+    for (int i = 2; i < argc; i++, clips++) {
+        encode_clip_t *clip = &encode_clips[clips];
+        const char *source = strchr(argv[i], '=');
+        if (!source || source == argv[i] || (size_t) (source - argv[i]) >= sizeof(clip->name)) {
+            fprintf(stderr, "%s: esperado nome=fonte\n", argv[i]);
+            return 2;
+        }
+        memcpy(clip->name, argv[i], source - argv[i]);
+        source++;
+
+        bool ok = strncmp(source, "tom:", 4) == 0 ? encode_tone(source + 4, clip) : encode_read_wav(source, clip);
+        if (!ok) {
+            fprintf(stderr, "%s: fonte inválida\n", argv[i]);
+            return 1;
+        }
+    }
+
+    // Nome base da saída, para o #include do .c
+    const char *base = strrchr(argv[1], '/');
+    base = base ? base + 1 : argv[1];
+
+    snprintf(path, sizeof(path), "%s.h", argv[1]);
+    FILE *header = fopen(path, "w");
+    snprintf(path, sizeof(path), "%s.c", argv[1]);
+    FILE *source = fopen(path, "w");
+    if (!header || !source) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    fprintf(header, "#include \"pico/stdlib.h\"\n#include \"audio.h\"\n\n");
+    fprintf(header, "#ifndef %s_inc_h\n#define %s_inc_h\n\n", base, base);
+    fprintf(source, "#include \"pico/stdlib.h\"\n#include \"%s.h\"\n\n", base);
+    for (uint f = 0; f < 2; f++) {
+        FILE *out = f ? source : header;
+        fprintf(out, "// Gerado por host/adpcm_encode.c; não edite. Para refazer:\n//  ");
+        for (int i = 0; i < argc; i++) {
+            fprintf(out, " %s", i ? argv[i] : "adpcm_encode");
+        }
+        fprintf(out, f ? "\n" : "\n\n");
+    }
+
+    uint32_t total = 0;
+    for (uint c = 0; c < clips; c++) {
+        const encode_clip_t *clip = &encode_clips[c];
+        uint32_t bytes = (clip->count + 1) / 2;
+        uint8_t *data = malloc(bytes);
+        double snr = encode_clip(clip, data);
+
+        fprintf(source, "\nstatic const uint8_t %s_data[%lu] = {", clip->name, (unsigned long) bytes);
+        for (uint32_t i = 0; i < bytes; i++) {
+            fprintf(source, "%s0x%02X,", i % 16 ? " " : "\n    ", data[i]);
+        }
+        fprintf(source, "\n};\n\nconst audio_clip_t %s = { %s_data, %lu, %lu };\n", clip->name, clip->name,
+                (unsigned long) clip->count, (unsigned long) clip->rate);
+        fprintf(header, "extern const audio_clip_t %s; // %lu ms a %lu Hz\n", clip->name,
+                (unsigned long) ((uint64_t) clip->count * 1000 / clip->rate), (unsigned long) clip->rate);
+
+        printf("%-24s %6lu amostras %6lu bytes %5.1f dB\n", clip->name, (unsigned long) clip->count,
+               (unsigned long) bytes, snr);
+        total += bytes;
+        free(data);
+    }
+    fprintf(header, "\n#endif\n");
+    printf("%-24s %6s          %6lu bytes na flash\n", "total", "", (unsigned long) total);
+
+    fclose(header);
+    fclose(source);
+    return 0;
+}
@@ -0,0 +1,398 @@
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pico/stdlib.h"
+
+// Gera as tabelas const (na flash) das imagens e fontes do display, já no formato da memória do
+// SSD1306: páginas de 8 linhas em sequência, um byte por coluna com a linha de cima no bit 0. Cada
+// argumento depois da saída é nome=fonte, onde a fonte é uma imagem PBM (P1 ou P4, 1 = pixel aceso,
+// o mesmo formato do "dump" do simulador), "rle:" seguido de uma imagem para guardá-la compactada
+// (ssd1306_packed_sprite_t) ou uma fonte BDF de largura fixa (ssd1306_font_t, códigos Latin-1).
+// Escreve <saída>.c e <saída>.h e imprime o tamanho de cada tabela:
+//
+//   asset_pack inc/assets ssd1306_font=assets/fonte_8x8.bdf icone_genius=rle:assets/genius.pbm
+
+#define pack_max_assets 32
+#define pack_max_size 255  // Largura e altura cabem em uint8_t
+#define pack_max_glyphs 256
+
+typedef enum {
+    pack_sprite,
+    pack_packed,
+    pack_font
+} pack_kind_t;
+
+typedef struct {
+    char name[64];
+    pack_kind_t kind;
+    uint width, height;   // Da imagem ou de cada glifo
+    uint8_t *data;        // Páginas da imagem ou glifos em sequência (o glifo 0 é o vazio)
+    uint length;          // Bytes em data
+    uint glyphs;
+    uint8_t index[256];   // Glifo de cada código Latin-1 (fontes)
+    uint8_t *packed;      // Dados compactados (rle:)
+    uint packed_length;
+} pack_asset_t;
+
+static pack_asset_t pack_assets[pack_max_assets];
+
+// Converte um bitmap de pixels (linha a linha, 0 ou 1) para páginas de colunas
+static void pack_pages(const uint8_t *pixels, uint width, uint height, uint8_t *pages) {
+    memset(pages, 0, width * ((height + 7) / 8));
+    for (uint y = 0; y < height; y++) {
+        for (uint x = 0; x < width; x++) {
+            if (pixels[y * width + x]) {
+                pages[(y / 8) * width + x] |= 1u << (y % 8);
+            }
+        }
+    }
+}
+
+// Próximo número do cabeçalho de um PBM, pulando espaços e comentários
+static bool pack_pbm_number(FILE *file, uint *value) {
+    int c = fgetc(file);
+
+    while (c == '#' || isspace(c)) {
+        if (c == '#') {
+            while (c != '\n' && c != EOF) {
+                c = fgetc(file);
+            }
+        }
+        c = fgetc(file);
+    }
+    if (!isdigit(c)) {
+        return false;
+    }
+    *value = 0;
+    while (isdigit(c)) {
+        *value = *value * 10 + (c - '0');
+        c = fgetc(file);
+    }
+    return true; // O separador depois do número já foi consumido (no P4, o único antes dos dados)
+}
+
+static bool pack_read_pbm(const char *path, pack_asset_t *asset) {
+    FILE *file = fopen(path, "rb");
+    char magic[2];
+
+    if (!file) {
+        perror(path);
+        return false;
+    }
+    if (fread(magic, 1, 2, file) != 2 || magic[0] != 'P' || (magic[1] != '1' && magic[1] != '4') ||
+        !pack_pbm_number(file, &asset->width) || !pack_pbm_number(file, &asset->height)) {
+        fprintf(stderr, "%s: esperado PBM (P1 ou P4)\n", path);
+        fclose(file);
+        return false;
+    }
+    if (asset->width == 0 || asset->height == 0 || asset->width > pack_max_size || asset->height > pack_max_size) {
+        fprintf(stderr, "%s: %ux%u fora de 1-%u pixels\n", path, asset->width, asset->height, pack_max_size);
+        fclose(file);
+        return false;
+    }
+
+    uint8_t *pixels = calloc(asset->width * asset->height, 1);
+    bool ok = true;
+    for (uint y = 0; y < asset->height && ok; y++) {
+        for (uint x = 0; x < asset->width && ok; x++) {
+            if (magic[1] == '1') {
+                int c;
+                do {
+                    c = fgetc(file);
+                } while (isspace(c));
+                ok = c == '0' || c == '1';
+                pixels[y * asset->width + x] = c == '1';
+            } else {
+                if (x % 8 == 0) {
+                    int c = fgetc(file);
+                    ok = c != EOF;
+                    pixels[y * asset->width + x] = c; // Guarda o byte; os bits são extraídos abaixo
+                }
+            }
+        }
+        if (magic[1] == '4') {
+            // Cada linha do P4 começa num byte novo; expande da direita para a esquerda para não
+            // sobrescrever os bytes ainda não lidos
+            for (int x = asset->width - 1; x >= 0; x--) {
+                uint8_t byte = pixels[y * asset->width + (x & ~7)];
+                pixels[y * asset->width + x] = (byte >> (7 - (x & 7))) & 1;
+            }
+        }
+    }
+    fclose(file);
+    if (!ok) {
+        fprintf(stderr, "%s: imagem incompleta\n", path);
+        free(pixels);
+        return false;
+    }
+
+    asset->length = asset->width * ((asset->height + 7) / 8);
+    asset->data = malloc(asset->length);
+    pack_pages(pixels, asset->width, asset->height, asset->data);
+    free(pixels);
+    return true;
+}
+
+// Lê uma fonte BDF de largura fixa. Cada glifo é posicionado na célula de FONTBOUNDINGBOX pelo seu BBX;
+// glifos sem nenhum pixel (o espaço, por exemplo) usam o glifo vazio 0 e não ocupam a tabela
+static bool pack_read_bdf(const char *path, pack_asset_t *asset) {
+    FILE *file = fopen(path, "r");
+    char line[256];
+    int box_width = 0, box_height = 0, box_x = 0, box_y = 0;
+    int encoding = -1;
+    int width = 0, height = 0, glyph_x = 0, glyph_y = 0;
+    uint8_t *pixels = NULL;
+    uint row = 0;
+    bool bitmap = false;
+
+    if (!file) {
+        perror(path);
+        return false;
+    }
+
+    while (fgets(line, sizeof(line), file)) {
+        if (sscanf(line, "FONTBOUNDINGBOX %d %d %d %d", &box_width, &box_height, &box_x, &box_y) == 4) {
+            if (box_width <= 0 || box_height <= 0 || box_width > pack_max_size || box_height > pack_max_size) {
+                break;
+            }
+            asset->width = box_width;
+            asset->height = box_height;
+            asset->length = box_width * ((box_height + 7) / 8);
+            asset->data = calloc(pack_max_glyphs, asset->length);
+            asset->glyphs = 1; // Glifo vazio
+            pixels = malloc(box_width * box_height);
+        } else if (sscanf(line, "ENCODING %d", &encoding) == 1) {
+        } else if (sscanf(line, "BBX %d %d %d %d", &width, &height, &glyph_x, &glyph_y) == 4) {
+        } else if (strncmp(line, "BITMAP", 6) == 0 && pixels) {
+            memset(pixels, 0, box_width * box_height);
+            bitmap = true;
+            row = 0;
+        } else if (strncmp(line, "ENDCHAR", 7) == 0 && bitmap) {
+            bitmap = false;
+            if (encoding < 0 || encoding > 255) {
+                continue; // Fora do Latin-1
+            }
+
+            if (asset->glyphs == pack_max_glyphs) {
+                fprintf(stderr, "%s: mais de %d glifos\n", path, pack_max_glyphs - 1);
+                break;
+            }
+
+            uint8_t *glyph = &asset->data[asset->glyphs * asset->length];
+            pack_pages(pixels, box_width, box_height, glyph);
+            bool empty = true;
+            for (uint i = 0; i < asset->length; i++) {
+                empty = empty && glyph[i] == 0;
+            }
+            if (!empty) {
+                asset->index[encoding] = asset->glyphs++;
+            }
+        } else if (bitmap) {
+            // Linha row do glifo (de cima para baixo), bit 7 do primeiro byte = coluna mais à esquerda
+            int cell_y = box_y + box_height - glyph_y - height + row;
+            for (int x = 0; x < width; x++) {
+                int cell_x = glyph_x - box_x + x;
+                uint digit = x / 4;
+                if (digit >= strlen(line) || !isxdigit((unsigned char) line[digit])) {
+                    break;
+                }
+                char hex[2] = { line[digit], 0 };
+                bool set = (strtoul(hex, NULL, 16) >> (3 - x % 4)) & 1;
+                if (set && cell_x >= 0 && cell_x < box_width && cell_y >= 0 && cell_y < box_height) {
+                    pixels[cell_y * box_width + cell_x] = 1;
+                }
+            }
+            row++;
+        }
+    }
+    fclose(file);
+    free(pixels);
+
+    if (!asset->data || asset->glyphs <= 1) {
+        fprintf(stderr, "%s: esperado BDF com FONTBOUNDINGBOX e glifos\n", path);
+        return false;
+    }
+    return true;
+}
+
+// PackBits: trechos de 2 ou mais bytes iguais viram um par (contagem negativa, byte); o restante vai
+// literal em blocos de até 128 bytes. Retorna o tamanho compactado
+static uint pack_rle(const uint8_t *data, uint length, uint8_t *out) {
+    uint n = 0;
+    uint i = 0;
+
+    while (i < length) {
+        uint run = 1;
+        while (i + run < length && run < 128 && data[i + run] == data[i]) {
+            run++;
+        }
+        if (run >= 2) {
+            out[n++] = (uint8_t) (int8_t) (1 - (int) run);
+            out[n++] = data[i];
+            i += run;
+            continue;
+        }
+
+        // Literais até o começo de uma repetição
+        uint start = i;
+        while (i < length && i - start < 128 && !(i + 1 < length && data[i + 1] == data[i])) {
+            i++;
+        }
+        out[n++] = i - start - 1;
+        memcpy(&out[n], &data[start], i - start);
+        n += i - start;
+    }
+    return n;
+}
+
+// Descompacta como ssd1306_draw_packed() faz, para conferir o resultado
+static bool pack_check_rle(const uint8_t *packed, uint packed_length, const uint8_t *data, uint length) {
+    uint n = 0;
+
+    for (uint i = 0; i < packed_length;) {
+        int8_t control = (int8_t) packed[i++];
+        if (control == INT8_MIN) {
+            continue;
+        }
+        uint count = control >= 0 ? control + 1 : 1 - control;
+        for (uint k = 0; k < count; k++) {
+            if (n >= length || data[n++] != (control >= 0 ? packed[i + k] : packed[i])) {
+                return false;
+            }
+        }
+        i += control >= 0 ? count : 1;
+    }
+    return n == length;
+}
+
+static void pack_bytes(FILE *out, const uint8_t *data, uint length) {
+    for (uint i = 0; i < length; i++) {
+        fprintf(out, "%s0x%02X,", i % 16 ? " " : "\n    ", data[i]);
+    }
+}
+
+int main(int argc, char **argv) {
+    char path[256];
+    uint assets = 0;
+
+    if (argc < 3 || argc - 2 > pack_max_assets) {
+        fprintf(stderr, "uso: %s <saída sem extensão> nome=imagem.pbm|nome=rle:imagem.pbm|nome=fonte.bdf ...\n",
+                argv[0]);
+        return 2;
+    }
+
+    for (int i = 2; i < argc; i++, assets++) {
+        pack_asset_t *asset = &pack_assets[assets];
+        const char *source = strchr(argv[i], '=');
+        if (!source || source == argv[i] || (size_t) (source - argv[i]) >= sizeof(asset->name)) {
+            fprintf(stderr, "%s: esperado nome=fonte\n", argv[i]);
+            return 2;
+        }
+        memcpy(asset->name, argv[i], source - argv[i]);
+        source++;
+
+        size_t length = strlen(source);
+        bool ok;
+        if (length > 4 && strcmp(&source[length - 4], ".bdf") == 0) {
+            asset->kind = pack_font;
+            ok = pack_read_bdf(source, asset);
+        } else if (strncmp(source, "rle:", 4) == 0) {
+            asset->kind = pack_packed;
+            ok = pack_read_pbm(source + 4, asset);
+        } else {
+            asset->kind = pack_sprite;
+            ok = pack_read_pbm(source, asset);
+        }
+        if (!ok) {
+            fprintf(stderr, "%s: fonte inválida\n", argv[i]);
+            return 1;
+        }
+
+        if (asset->kind == pack_packed) {
+            // Pior caso do PackBits: um byte de controle a cada 128 literais
+            asset->packed = malloc(asset->length + asset->length / 128 + 1);
+            asset->packed_length = pack_rle(asset->data, asset->length, asset->packed);
+            if (!pack_check_rle(asset->packed, asset->packed_length, asset->data, asset->length)) {
+                fprintf(stderr, "%s: RLE não confere\n", argv[i]);
+                return 1;
+            }
+        }
+    }
+
+    // Nome base da saída, para o #include do .c
+    const char *base = strrchr(argv[1], '/');
+    base = base ? base + 1 : argv[1];
+
+    snprintf(path, sizeof(path), "%s.h", argv[1]);
+    FILE *header = fopen(path, "w");
+    snprintf(path, sizeof(path), "%s.c", argv[1]);
+    FILE *source = fopen(path, "w");
+    if (!header || !source) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    fprintf(header, "#include \"pico/stdlib.h\"\n#include \"ssd1306_i2c.h\"\n\n");
+    fprintf(header, "#ifndef %s_inc_h\n#define %s_inc_h\n\n", base, base);
+    fprintf(source, "#include \"pico/stdlib.h\"\n#include \"%s.h\"\n\n", base);
+    for (uint f = 0; f < 2; f++) {
+        FILE *out = f ? source : header;
+        fprintf(out, "// Gerado por host/asset_pack.c (alvo assets do CMake); não edite. Para refazer:\n//  ");
+        for (int i = 0; i < argc; i++) {
+            fprintf(out, " %s", i ? argv[i] : "asset_pack");
+        }
+        fprintf(out, f ? "\n" : "\n\n");
+    }
+
+    uint total = 0;
+    for (uint a = 0; a < assets; a++) {
+        const pack_asset_t *asset = &pack_assets[a];
+        uint bytes = 0;
+
+        switch (asset->kind) {
+            case pack_sprite:
+                fprintf(source, "\nstatic const uint8_t %s_data[%u] = {", asset->name, asset->length);
+                pack_bytes(source, asset->data, asset->length);
+                fprintf(source, "\n};\n\nconst ssd1306_sprite_t %s = { %u, %u, %s_data };\n", asset->name,
+                        asset->width, asset->height, asset->name);
+                fprintf(header, "extern const ssd1306_sprite_t %s; // %ux%u\n", asset->name, asset->width,
+                        asset->height);
+                bytes = asset->length;
+                printf("%-24s imagem %3ux%-3u %6u bytes\n", asset->name, asset->width, asset->height, bytes);
+                break;
+            case pack_packed:
+                fprintf(source, "\nstatic const uint8_t %s_data[%u] = {", asset->name, asset->packed_length);
+                pack_bytes(source, asset->packed, asset->packed_length);
+                fprintf(source, "\n};\n\nconst ssd1306_packed_sprite_t %s = { %u, %u, %u, %s_data };\n",
+                        asset->name, asset->width, asset->height, asset->packed_length, asset->name);
+                fprintf(header, "extern const ssd1306_packed_sprite_t %s; // %ux%u, RLE\n", asset->name,
+                        asset->width, asset->height);
+                bytes = asset->packed_length;
+                printf("%-24s imagem %3ux%-3u %6u bytes (RLE; %u sem compactar)\n", asset->name, asset->width,
+                       asset->height, bytes, asset->length);
+                break;
+            case pack_font:
+                fprintf(source, "\nstatic const uint8_t %s_glyphs[%u] = {", asset->name,
+                        asset->glyphs * asset->length);
+                pack_bytes(source, asset->data, asset->glyphs * asset->length);
+                fprintf(source, "\n};\n\nstatic const uint8_t %s_index[256] = {", asset->name);
+                pack_bytes(source, asset->index, 256);
+                fprintf(source, "\n};\n\nconst ssd1306_font_t %s = { %u, %u, %s_glyphs, %s_index };\n",
+                        asset->name, asset->width, asset->height, asset->name, asset->name);
+                fprintf(header, "extern const ssd1306_font_t %s; // %ux%u, %u glifos\n", asset->name, asset->width,
+                        asset->height, asset->glyphs);
+                bytes = asset->glyphs * asset->length + 256;
+                printf("%-24s fonte  %3ux%-3u %6u bytes (%u glifos)\n", asset->name, asset->width, asset->height,
+                       bytes, asset->glyphs);
+                break;
+        }
+        total += bytes;
+    }
+    fprintf(header, "\n#endif\n");
+    printf("%-24s %14s %6u bytes na flash\n", "total", "", total);
+
+    fclose(header);
+    fclose(source);
+    return 0;
+}
@@ -0,0 +1,414 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "pico/stdlib.h"
+#include "inc/hal.h"
+#include "inc/hal_host.h"
+#include "inc/ssd1306.h"
+#include "inc/assets.h"
+
+// Benchmarks do caminho do display, rodando sobre o simulador (inc/hal_host.c).
+// Tempos de CPU são do PC (servem para comparar versões, não para prever o RP2040);
+// bytes, transações e tempo de barramento por atualização são exatos para o firmware
+
+#define bench_min_seconds 0.2 // Cada medição repete a operação por pelo menos este tempo
+#define bench_therapist_bus 0  // Display do terapeuta no conector do i2c0 (GPIO 0 e 1)
+#define bench_second_address _u(0x3D) // Segundo painel no barramento do display da placa
+
+// Geometrias medidas: a da placa, a do display do terapeuta e uma sem o tamanho de nenhum dos dois
+#define ssd1306_panel_name bench_128x64
+#define ssd1306_panel_width 128
+#define ssd1306_panel_height 64
+#include "inc/ssd1306_panel.h"
+
+#define ssd1306_panel_name bench_128x32
+#define ssd1306_panel_width 128
+#define ssd1306_panel_height 32
+#include "inc/ssd1306_panel.h"
+
+#define ssd1306_panel_name bench_96x64
+#define ssd1306_panel_width 96
+#define ssd1306_panel_height 64
+#include "inc/ssd1306_panel.h"
+
+static ssd1306_t bench_panel;
+static ssd1306_t bench_panels[2]; // Display do terapeuta (i2c0) e um segundo painel no i2c1
+static int bench_failures = 0;
+static volatile int bench_areas; // Resultado das buscas medidas, para o compilador não descartá-las
+
+static double bench_now() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+// Roda a operação em lotes até somar bench_min_seconds; retorna nanossegundos por chamada
+static double bench_measure(void (*operation)(uint iteration), uint calls_per_iteration) {
+    uint64_t iterations = 0;
+    uint64_t batch = 1;
+    double start = bench_now();
+    double elapsed;
+
+    do {
+        for (uint64_t i = 0; i < batch; i++) {
+            operation(iterations + i);
+        }
+        iterations += batch;
+        batch *= 2;
+        elapsed = bench_now() - start;
+    } while (elapsed < bench_min_seconds);
+
+    return elapsed * 1e9 / (iterations * calls_per_iteration);
+}
+
+// Acende e apaga todos os pixels da tela
+static void bench_set_pixel(uint iteration) {
+    bool set = !(iteration & 1);
+    for (int y = 0; y < ssd1306_height; y++) {
+        for (int x = 0; x < ssd1306_width; x++) {
+            ssd1306_set_pixel(bench_panel.frame.data, x, y, set);
+        }
+    }
+}
+
+// Mistura de linhas horizontais, verticais, diagonais e íngremes
+static const int bench_lines[][4] = {
+    { 0, 0, 127, 0 }, { 0, 63, 127, 63 }, { 0, 0, 0, 63 }, { 127, 0, 127, 63 },
+    { 0, 0, 127, 63 }, { 0, 63, 127, 0 }, { 10, 0, 20, 63 }, { 64, 10, 100, 30 },
+};
+
+static void bench_draw_line(uint iteration) {
+    for (uint i = 0; i < count_of(bench_lines); i++) {
+        const int *line = bench_lines[i];
+        ssd1306_draw_line(bench_panel.frame.data, line[0], line[1], line[2], line[3], !(iteration & 1));
+    }
+}
+
+// Retas horizontais e verticais, cada uma com um extremo fora da tela (recorte)
+static void bench_draw_spans(uint iteration) {
+    bool set = !(iteration & 1);
+    for (int i = 0; i < 8; i++) {
+        ssd1306_draw_hline(bench_panel.frame.data, -5, 140, i * 9, set);
+        ssd1306_draw_vline(bench_panel.frame.data, i * 17, -3, 70, set);
+    }
+}
+
+static void bench_fill_rect(uint iteration) {
+    ssd1306_fill_rect(bench_panel.frame.data, 3, 5, 120, 50, !(iteration & 1));
+}
+
+static void bench_invert_rect(uint iteration) {
+    ssd1306_invert_rect(bench_panel.frame.data, 0, 24 + (iteration % 5), 128, 12);
+}
+
+static void bench_circles(uint iteration) {
+    ssd1306_draw_circle(bench_panel.frame.data, 32, 32, 20, !(iteration & 1));
+    ssd1306_fill_circle(bench_panel.frame.data, 96, 32, 20, !(iteration & 1));
+}
+
+// Rodapé e topo como o jogo redesenha durante a entrada do jogador
+static void bench_progress(uint iteration) {
+    ssd1306_draw_progress(bench_panel.frame.data, 4, 54, 120, 9, iteration % 11, 10);
+    ssd1306_draw_round_indicator(bench_panel.frame.data, 64, 4, iteration % 11, 10);
+}
+
+static const char bench_short_text[] = "Rodada 10";
+static const char bench_full_text[] = "Aperte Botão A!!";
+
+static void bench_draw_short(uint iteration) {
+    bench_128x64_draw_string(bench_panel.frame.data, 5, (iteration % 8) * 8, bench_short_text);
+}
+
+static void bench_draw_full(uint iteration) {
+    bench_128x64_draw_string(bench_panel.frame.data, 0, (iteration % 8) * 8, bench_full_text);
+}
+
+// Linha de pixels fora das páginas: cada caractere se divide entre duas páginas
+static void bench_draw_unaligned(uint iteration) {
+    bench_128x64_draw_string(bench_panel.frame.data, 5, 3 + (iteration % 7) * 8, bench_short_text);
+}
+
+// Mesmo texto pelo caminho genérico das fontes geradas (um sprite por caractere)
+static void bench_draw_text(uint iteration) {
+    bench_128x64_draw_text(bench_panel.frame.data, 5, 3 + (iteration % 7) * 8, &ssd1306_font, bench_short_text);
+}
+
+// Ícone compactado, descompactado página por página durante o desenho
+static void bench_draw_packed(uint iteration) {
+    bench_128x64_draw_packed(bench_panel.frame.data, 48 + (iteration % 3), 16, &icone_genius, ssd1306_blend_copy);
+}
+
+// A fonte gerada desenhada por ssd1306_draw_text precisa dar o mesmo quadro que ssd1306_draw_string
+static bool bench_text_matches() {
+    static uint8_t expected[ssd1306_buffer_length];
+
+    memset(bench_panel.frame.data, 0, ssd1306_buffer_length);
+    ssd1306_draw_string(bench_panel.frame.data, -3, 21, bench_full_text);
+    memcpy(expected, bench_panel.frame.data, ssd1306_buffer_length);
+    memset(bench_panel.frame.data, 0, ssd1306_buffer_length);
+    ssd1306_draw_text(bench_panel.frame.data, -3, 21, &ssd1306_font, bench_full_text);
+    return memcmp(expected, bench_panel.frame.data, ssd1306_buffer_length) == 0;
+}
+
+// A geometria de 32 linhas recorta na página 3 o texto que o quadro inteiro desenharia até a página 4
+static bool bench_clip_matches() {
+    static uint8_t expected[ssd1306_buffer_length];
+    const int visible = 4 * ssd1306_width;
+
+    memset(expected, 0, ssd1306_buffer_length);
+    ssd1306_draw_string(expected, 90, 28, bench_full_text);
+    memset(bench_panel.frame.data, 0, ssd1306_buffer_length);
+    bench_128x32_draw_string(bench_panel.frame.data, 90, 28, bench_full_text);
+    for (int i = visible; i < ssd1306_buffer_length; i++) {
+        if (bench_panel.frame.data[i]) {
+            return false;
+        }
+    }
+    return memcmp(expected, bench_panel.frame.data, visible) == 0;
+}
+
+static void bench_draw_clear(uint iteration) {
+    memset(bench_panel.frame.data, 0, ssd1306_buffer_length);
+}
+
+// Procura as alterações com um só pixel mudado no canto inferior direito: todas as páginas são comparadas
+// e só a última tem uma área. A cópia começa igual ao quadro limpo
+static void bench_touch(ssd1306_t *panel) {
+    panel->frame.data[(panel->pages - 1) * ssd1306_width + panel->width - 1] ^= 0x80;
+}
+
+static void bench_scan_128x64(uint iteration) {
+    struct render_area areas[ssd1306_n_pages];
+
+    bench_touch(&bench_panel);
+    bench_areas = bench_128x64_dirty_areas(&bench_panel, areas);
+}
+
+static void bench_scan_128x32(uint iteration) {
+    struct render_area areas[ssd1306_n_pages];
+
+    bench_touch(&bench_panels[0]);
+    bench_areas = bench_128x32_dirty_areas(&bench_panels[0], areas);
+}
+
+static void bench_scan_96x64(uint iteration) {
+    struct render_area areas[ssd1306_n_pages];
+
+    bench_touch(&bench_panels[1]);
+    bench_areas = bench_96x64_dirty_areas(&bench_panels[1], areas);
+}
+
+// Desenha uma ou duas linhas como o serviço de interface faz (quadro limpo e texto na página)
+static void bench_message(const char *line1, int page1, const char *line2, int page2) {
+    memset(bench_panel.frame.data, 0, ssd1306_buffer_length);
+    bench_128x64_draw_string(bench_panel.frame.data, 5, page1 * 8, line1);
+    if (line2) {
+        bench_128x64_draw_string(bench_panel.frame.data, 5, page2 * 8, line2);
+    }
+}
+
+// O painel emulado precisa terminar idêntico ao quadro, senão o driver pulou alguma região
+static bool bench_matches(const ssd1306_t *panel) {
+    const uint8_t *ram = hal_host_panel(panel->bus, panel->address);
+
+    if (!ram) {
+        return false;
+    }
+    for (int page = 0; page < panel->pages; page++) {
+        if (memcmp(&ram[page * ssd1306_width], &panel->frame.data[page * ssd1306_width], panel->width)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Envia o quadro atual e imprime o custo da atualização no barramento
+static void bench_update(const char *name, bool async) {
+    hal_host_i2c_stats_t stats;
+
+    hal_host_i2c_reset_stats(ssd1306_i2c_bus);
+    if (async) {
+        bench_128x64_flush_async(&bench_panel, NULL);
+        ssd1306_async_wait(&bench_panel);
+    } else {
+        bench_128x64_flush(&bench_panel);
+    }
+
+    bool match = bench_matches(&bench_panel);
+
+    hal_host_i2c_stats(ssd1306_i2c_bus, &stats);
+    printf("  %-34s %5s %6lu %8lu %8lu %9.1f  %s\n", name, async ? "async" : "sync",
+           (unsigned long) stats.transactions, (unsigned long) stats.bytes, (unsigned long) stats.pixels,
+           stats.bus_us / 1000.0, match ? "ok" : "DIFERENTE");
+    bench_failures += !match;
+}
+
+// Custo no barramento de um comando de efeito, para comparar com o reenvio do quadro
+static void bench_effect(const char *name, void (*effect)(void)) {
+    hal_host_i2c_stats_t stats;
+
+    hal_host_i2c_reset_stats(ssd1306_i2c_bus);
+    effect();
+    hal_host_i2c_stats(ssd1306_i2c_bus, &stats);
+    printf("  %-34s %6lu %8lu %9.2f\n", name, (unsigned long) stats.transactions, (unsigned long) stats.bytes,
+           stats.bus_us / 1000.0);
+}
+
+static void bench_contrast() {
+    ssd1306_set_contrast_level(&bench_panel, 0x40);
+}
+
+static void bench_invert() {
+    ssd1306_set_inverted(&bench_panel, true);
+}
+
+static void bench_start_line() {
+    ssd1306_set_start_line(&bench_panel, 8);
+}
+
+static void bench_scroll() {
+    ssd1306_scroll_diagonal(&bench_panel, false, 3, 4, ssd1306_scroll_frames_4, 1, 0);
+}
+
+// Restaura o painel; a rolagem deixou a RAM deslocada e o próximo envio precisa corrigi-la
+static void bench_restore() {
+    hal_wait_until(hal_time_us() + 500000); // Meio segundo de rolagem no relógio virtual
+    ssd1306_scroll_stop(&bench_panel);
+    ssd1306_set_start_line(&bench_panel, 0);
+    ssd1306_set_inverted(&bench_panel, false);
+    ssd1306_set_contrast_level(&bench_panel, 0xFF);
+}
+
+// Envio assíncrono pela geometria de cada painel do teste
+static void bench_flush_async(ssd1306_t *panel) {
+    if (panel->height == 32) {
+        bench_128x32_flush_async(panel, NULL);
+    } else {
+        bench_128x64_flush_async(panel, NULL);
+    }
+}
+
+// Envia um quadro completo a cada painel ao mesmo tempo e imprime o tempo de cada barramento. Cada
+// barramento transmite em paralelo, então o quadro termina quando o mais ocupado terminar
+static void bench_panels_update(const char *name, ssd1306_t *panels[], uint count) {
+    hal_host_i2c_stats_t stats[ssd1306_bus_count];
+    bool match = true;
+
+    for (uint bus = 0; bus < ssd1306_bus_count; bus++) {
+        hal_host_i2c_reset_stats(bus);
+    }
+    for (uint i = 0; i < count; i++) {
+        memset(panels[i]->frame.data, 0, ssd1306_buffer_length);
+        bench_128x64_draw_string(panels[i]->frame.data, 5, 8 * i, "Painel");
+        ssd1306_fill_rect(panels[i]->frame.data, 0, 16, panels[i]->width, panels[i]->height - 16, true);
+        ssd1306_invalidate(panels[i]);
+        bench_flush_async(panels[i]);
+    }
+    for (uint i = 0; i < count; i++) {
+        ssd1306_async_wait(panels[i]);
+        match = match && bench_matches(panels[i]);
+    }
+
+    uint64_t frame_us = 0;
+    for (uint bus = 0; bus < ssd1306_bus_count; bus++) {
+        hal_host_i2c_stats(bus, &stats[bus]);
+        frame_us = MAX(frame_us, stats[bus].bus_us);
+    }
+    printf("  %-34s %9.1f %9.1f %9.1f  %s\n", name, stats[0].bus_us / 1000.0, stats[1].bus_us / 1000.0,
+           frame_us / 1000.0, match ? "ok" : "DIFERENTE");
+    bench_failures += !match;
+}
+
+// Sequência de telas típica de uma partida, enviada pelos dois caminhos do driver
+static void bench_updates(bool async) {
+    ssd1306_invalidate(&bench_panel);
+
+    bench_message("Aperte Botão A", 3, NULL, 0);
+    bench_update("tela inicial (quadro completo)", async);
+    bench_update("sem alteracoes", async);
+
+    bench_message("Rodada 1", 3, NULL, 0);
+    bench_update("troca de mensagem", async);
+    bench_message("Rodada 2", 3, NULL, 0);
+    bench_update("troca de um digito", async);
+
+    ssd1306_draw_progress(bench_panel.frame.data, 4, 54, 120, 9, 1, 3);
+    bench_update("barra de progresso", async);
+    ssd1306_draw_progress(bench_panel.frame.data, 4, 54, 120, 9, 2, 3);
+    bench_update("avanco da barra", async);
+
+    bench_message("Você venceu!", 3, "Parabéns!", 4);
+    bench_update("duas linhas", async);
+
+    ssd1306_set_pixel(bench_panel.frame.data, 127, 63, true);
+    bench_update("um pixel", async);
+
+    memset(bench_panel.frame.data, 0xFF, ssd1306_buffer_length);
+    bench_update("tela cheia", async);
+}
+
+int main() {
+    hal_init();
+    hal_i2c_init(ssd1306_i2c_bus, 14, 15, ssd1306_i2c_clock * 1000);
+    hal_i2c_init(bench_therapist_bus, 0, 1, ssd1306_i2c_clock * 1000);
+    bench_128x64_init(&bench_panel, ssd1306_i2c_address, ssd1306_i2c_bus);
+
+    printf("Desenho (CPU do PC, ns por chamada)\n");
+    printf("  %-34s %9.1f\n", "ssd1306_set_pixel", bench_measure(bench_set_pixel, ssd1306_buffer_length * 8));
+    printf("  %-34s %9.1f\n", "ssd1306_draw_line", bench_measure(bench_draw_line, count_of(bench_lines)));
+    printf("  %-34s %9.1f\n", "hline + vline (recortadas)", bench_measure(bench_draw_spans, 16));
+    printf("  %-34s %9.1f\n", "ssd1306_fill_rect (120x50)", bench_measure(bench_fill_rect, 1));
+    printf("  %-34s %9.1f\n", "ssd1306_invert_rect (128x12)", bench_measure(bench_invert_rect, 1));
+    printf("  %-34s %9.1f\n", "circulo (contorno + cheio, r=20)", bench_measure(bench_circles, 1));
+    printf("  %-34s %9.1f\n", "barra de progresso + rodadas", bench_measure(bench_progress, 1));
+    printf("  %-34s %9.1f\n", "draw_string (9 caracteres)", bench_measure(bench_draw_short, 1));
+    printf("  %-34s %9.1f\n", "draw_string (16 caracteres)", bench_measure(bench_draw_full, 1));
+    printf("  %-34s %9.1f\n", "draw_string (y qualquer)", bench_measure(bench_draw_unaligned, 1));
+    printf("  %-34s %9.1f\n", "draw_text (9 caracteres)", bench_measure(bench_draw_text, 1));
+    printf("  %-34s %9.1f\n", "draw_packed (32x32, RLE)", bench_measure(bench_draw_packed, 1));
+    printf("  %-34s %9.1f\n", "limpar quadro (memset)", bench_measure(bench_draw_clear, 1));
+    if (!bench_text_matches()) {
+        printf("  ssd1306_draw_text DIFERENTE de ssd1306_draw_string\n");
+        bench_failures++;
+    }
+    if (!bench_clip_matches()) {
+        printf("  draw_string em 128x32 recortado DIFERENTE do quadro inteiro\n");
+        bench_failures++;
+    }
+    bench_128x32_init(&bench_panels[0], ssd1306_i2c_address, bench_therapist_bus);
+    bench_96x64_init(&bench_panels[1], bench_second_address, ssd1306_i2c_bus);
+    memset(bench_panel.frame.data, 0, ssd1306_buffer_length);
+    for (uint i = 0; i < count_of(bench_panels); i++) {
+        ssd1306_commit_areas(&bench_panels[i], NULL, 0);
+    }
+    ssd1306_commit_areas(&bench_panel, NULL, 0);
+    printf("  %-34s %9.1f\n", "dirty_areas (128x64)", bench_measure(bench_scan_128x64, 1));
+    printf("  %-34s %9.1f\n", "dirty_areas (128x32)", bench_measure(bench_scan_128x32, 1));
+    printf("  %-34s %9.1f\n", "dirty_areas (96x64)", bench_measure(bench_scan_96x64, 1));
+
+    printf("\nAtualização do display (i2c%d a %d kHz)\n", ssd1306_i2c_bus, ssd1306_i2c_clock);
+    printf("  %-34s %5s %6s %8s %8s %9s  %s\n", "cenario", "modo", "trans.", "bytes", "pixels", "ms", "painel");
+    bench_updates(false);
+    bench_updates(true);
+
+    printf("\nEfeitos no controlador\n");
+    printf("  %-34s %6s %8s %9s\n", "comando", "trans.", "bytes", "ms");
+    bench_message("Você venceu!", 3, "Parabéns!", 4);
+    bench_128x64_flush(&bench_panel);
+    bench_effect("contraste", bench_contrast);
+    bench_effect("modo inverso", bench_invert);
+    bench_effect("linha inicial", bench_start_line);
+    bench_effect("rolagem diagonal", bench_scroll);
+    bench_effect("parar e restaurar", bench_restore);
+    bench_update("quadro depois da rolagem", false);
+
+    printf("\nVários painéis (quadro completo em cada, envio assíncrono)\n");
+    printf("  %-34s %9s %9s %9s  %s\n", "configuracao", "i2c0 ms", "i2c1 ms", "quadro ms", "paineis");
+    bench_128x32_init(&bench_panels[0], ssd1306_i2c_address, bench_therapist_bus);
+    bench_128x64_init(&bench_panels[1], bench_second_address, ssd1306_i2c_bus);
+    bench_panels_update("um painel (i2c1)", (ssd1306_t *[]) { &bench_panel }, 1);
+    bench_panels_update("i2c1 + i2c0 (terapeuta 128x32)", (ssd1306_t *[]) { &bench_panel, &bench_panels[0] }, 2);
+    bench_panels_update("dois no i2c1 (0x3C + 0x3D)", (ssd1306_t *[]) { &bench_panel, &bench_panels[1] }, 2);
+
+    return bench_failures ? 1 : 0;
+}
@@ -0,0 +1,29 @@
+// Substituto de "pico/stdlib.h" para a compilação no PC: só os tipos e macros básicos que os módulos
+// usam. Todo acesso ao hardware passa por inc/hal.h, implementado no PC por inc/hal_host.c
+
+#ifndef _PICO_STDLIB_H
+#define _PICO_STDLIB_H
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef unsigned int uint;
+
+#define _u(x) x ## u
+#define count_of(a) (sizeof(a) / sizeof((a)[0]))
+
+#ifndef MIN
+#define MIN(a, b) ((b) > (a) ? (a) : (b))
+#endif
+#ifndef MAX
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+#endif
+
+#define PICO_ERROR_GENERIC -1
+
+static inline void tight_loop_contents(void) {
+}
+
+#endif
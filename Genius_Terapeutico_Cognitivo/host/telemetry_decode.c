@@ -0,0 +1,204 @@
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "pico/stdlib.h"
+#include "inc/telemetry.h"
+#include "inc/session_log.h"
+
+// Decodificador da telemetria (inc/telemetry.h) para o PC. Lê a porta serial da placa (configurada
+// antes com "stty -F /dev/ttyACM0 raw") ou o arquivo gravado pelo simulador em GENIUS_TELEMETRY e
+// imprime um evento por linha. O texto do printf, que chega misturado na mesma porta, sai com "| "
+
+// Mesma ordem de GameState e ColorState em Genius_Terapeutico_Cognitivo.c
+static const char *const decode_states[] = {
+    "IDLE", "WELCOME", "SETUP_ROUNDS", "PLAYBACK", "INPUT", "SUCCESS", "FAILURE", "SLEEP",
+};
+static const char *const decode_colors[] = { "magenta", "verde", "azul", "amarelo", "centro" };
+
+static uint8_t decode_buffer[4096];
+static uint decode_length = 0;
+static char decode_text[256];
+static uint decode_text_length = 0;
+
+static bool decode_started = false;
+static uint8_t decode_next_sequence = 0;
+static uint32_t decode_last_low = 0;
+static uint64_t decode_high = 0;   // Voltas completas do instante de 32 bits
+static uint32_t decode_frames = 0;
+static uint32_t decode_lost = 0;
+
+// Mesmo CRC-8 de inc/telemetry.c (polinômio 0x07, valor inicial 0)
+static uint8_t decode_crc(const uint8_t *data, uint length) {
+    uint8_t crc = 0;
+
+    for (uint i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x80) ? (crc << 1) ^ 0x07 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+static const char *decode_name(const char *const *names, uint count, uint index) {
+    return index < count ? names[index] : "?";
+}
+
+// Bytes fora de quadros: texto do printf, impresso linha a linha
+static void decode_text_byte(uint8_t byte) {
+    if (byte == '\n' || decode_text_length == sizeof(decode_text) - 1) {
+        decode_text[decode_text_length] = '\0';
+        printf("| %s\n", decode_text);
+        decode_text_length = 0;
+    }
+    if (byte != '\n' && byte != '\r') {
+        decode_text[decode_text_length++] = byte;
+    }
+}
+
+static void decode_frame(const uint8_t *frame) {
+    uint8_t type = frame[1];
+    uint8_t length = frame[2];
+    uint8_t sequence = frame[3];
+    uint32_t low = frame[4] | frame[5] << 8 | frame[6] << 16 | (uint32_t) frame[7] << 24;
+    const uint8_t *payload = &frame[telemetry_header_length];
+
+    // Um boot recomeça a sequência e o relógio; nos demais quadros, salto na sequência é perda
+    if (type == telemetry_boot) {
+        decode_high = 0;
+    } else if (decode_started && sequence != decode_next_sequence) {
+        uint8_t lost = sequence - decode_next_sequence;
+        printf("-- %u quadros perdidos\n", lost);
+        decode_lost += lost;
+    }
+    if (decode_started && type != telemetry_boot && low < decode_last_low) {
+        decode_high += 1ull << 32;
+    }
+    decode_started = true;
+    decode_next_sequence = sequence + 1;
+    decode_last_low = low;
+    decode_frames++;
+
+    printf("[%11.6f s] ", (decode_high + low) / 1e6);
+    if (type == telemetry_boot && length == sizeof(telemetry_boot_t)) {
+        telemetry_boot_t boot;
+        memcpy(&boot, payload, sizeof(boot));
+        printf("boot: formato %u, %u partidas no registro\n", boot.version, boot.sessions);
+    } else if (type == telemetry_state && length == sizeof(telemetry_state_t)) {
+        telemetry_state_t state;
+        memcpy(&state, payload, sizeof(state));
+        printf("estado %s, rodada %u de %u\n", decode_name(decode_states, count_of(decode_states), state.state),
+               state.round, state.total_rounds);
+    } else if (type == telemetry_joystick && length == 1) {
+        printf("joystick %s\n", decode_name(decode_colors, count_of(decode_colors), payload[0]));
+    } else if (type == telemetry_step && length == sizeof(telemetry_step_t)) {
+        telemetry_step_t step;
+        memcpy(&step, payload, sizeof(step));
+        printf("rodada %u, passo %u: %s (esperado %s) em %.3f s%s\n", step.round, step.step,
+               decode_name(decode_colors, count_of(decode_colors), step.chosen),
+               decode_name(decode_colors, count_of(decode_colors), step.expected), step.latency_us / 1e6,
+               step.chosen == step.expected ? "" : " ERRO");
+    } else if (type == telemetry_session && length == sizeof(session_log_record_t)) {
+        session_log_record_t record;
+        memcpy(&record, payload, sizeof(record));
+        printf("partida %lu: %u de %u rodadas em %.1f s, ", (unsigned long) record.serial, record.max_rounds,
+               record.total_rounds, record.duration_ms / 1000.0);
+        if (record.failed_step) {
+            printf("erro no passo %u\n", record.failed_step);
+        } else {
+            printf("vitória\n");
+        }
+    } else if (type == telemetry_summary && length == sizeof(telemetry_summary_t)) {
+        telemetry_summary_t summary;
+        memcpy(&summary, payload, sizeof(summary));
+        if (summary.scope == telemetry_summary_round) {
+            printf("rodada %u: ", summary.index);
+        } else if (summary.scope == telemetry_summary_color) {
+            printf("cor %s: ", decode_name(decode_colors, count_of(decode_colors), summary.index));
+        } else {
+            printf("partida: ");
+        }
+        printf("%u respostas, média %u ms (desvio %u), de %u a %u ms", summary.count, summary.mean_ms,
+               summary.stddev_ms, summary.min_ms, summary.max_ms);
+        if (summary.scope != telemetry_summary_round) {
+            printf(", mediana %u ms, p90 %u ms, %u erros", summary.median_ms, summary.p90_ms, summary.errors);
+        }
+        printf("\n");
+    } else if (type == telemetry_histogram && length == sizeof(telemetry_histogram_t)) {
+        telemetry_histogram_t histogram;
+        memcpy(&histogram, payload, sizeof(histogram));
+        printf("histograma (faixas de 100 ms):");
+        for (uint i = 0; i < count_of(histogram.bins); i++) {
+            printf(" %u", histogram.bins[i]);
+        }
+        printf("\n");
+    } else if (type == telemetry_drops && length == sizeof(telemetry_drops_t)) {
+        telemetry_drops_t drops;
+        memcpy(&drops, payload, sizeof(drops));
+        printf("descartados na placa: %lu quadros (%lu bytes)\n", (unsigned long) drops.frames,
+               (unsigned long) drops.bytes);
+    } else {
+        printf("tipo %u desconhecido (%u bytes)\n", type, length);
+    }
+}
+
+// Separa os quadros válidos do texto; um quadro incompleto fica no buffer até chegar o resto
+static void decode_process(bool end) {
+    uint i = 0;
+
+    while (i < decode_length) {
+        uint8_t *frame = &decode_buffer[i];
+        uint available = decode_length - i;
+
+        if (frame[0] != telemetry_sync || (available >= 3 && frame[2] > telemetry_max_payload)) {
+            decode_text_byte(decode_buffer[i++]);
+            continue;
+        }
+        if (available < telemetry_header_length || available < telemetry_frame_length(frame[2])) {
+            if (!end) {
+                break;
+            }
+            decode_text_byte(decode_buffer[i++]);
+            continue;
+        }
+
+        uint size = telemetry_frame_length(frame[2]);
+        if (decode_crc(&frame[1], size - 2) != frame[size - 1]) {
+            decode_text_byte(decode_buffer[i++]); // Não era quadro (ou chegou corrompido)
+            continue;
+        }
+        decode_frame(frame);
+        i += size;
+    }
+
+    memmove(decode_buffer, &decode_buffer[i], decode_length - i);
+    decode_length -= i;
+}
+
+int main(int argc, char **argv) {
+    int input = STDIN_FILENO;
+
+    if (argc > 2 || (argc == 2 && strcmp(argv[1], "-h") == 0)) {
+        fprintf(stderr, "uso: %s [porta serial ou arquivo]\n", argv[0]);
+        return 2;
+    }
+    if (argc == 2 && (input = open(argv[1], O_RDONLY)) < 0) {
+        perror(argv[1]);
+        return 1;
+    }
+    setvbuf(stdout, NULL, _IOLBF, 0);
+
+    ssize_t count;
+    while ((count = read(input, &decode_buffer[decode_length], sizeof(decode_buffer) - decode_length)) > 0) {
+        decode_length += count;
+        decode_process(false);
+    }
+    decode_process(true);
+    if (decode_text_length) {
+        decode_text_byte('\n');
+    }
+
+    printf("-- %lu quadros, %lu perdidos\n", (unsigned long) decode_frames, (unsigned long) decode_lost);
+    return 0;
+}
@@ -0,0 +1,128 @@
+#include <math.h>
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "inc/metrics.h"
+
+// Verificação das estatísticas de tempo de reação (inc/metrics.c) com dados conhecidos: Welford
+// (média, variância, mínimo e máximo), quantis P², histograma, erros e os grupos por cor e rodada
+
+static int test_failures = 0;
+
+#define test_check(condition, ...) do { \
+        if (!(condition)) { \
+            printf("  FALHOU (linha %d): ", __LINE__); \
+            printf(__VA_ARGS__); \
+            printf("\n"); \
+            test_failures++; \
+        } \
+    } while (0)
+
+static uint64_t test_now = 1000000;
+
+// Uma resposta com o tempo de reação dado, medido desde o fim da apresentação
+static void test_answer(uint8_t color, uint16_t round, uint32_t latency_us, bool correct) {
+    metrics_playback_end(test_now);
+    test_now += latency_us;
+    metrics_input(color, round, test_now, correct);
+    metrics_process();
+}
+
+static bool test_near(float value, float expected, float tolerance) {
+    return fabsf(value - expected) <= tolerance;
+}
+
+// 1 a 1000 ms numa ordem embaralhada (passo 7919, primo com 1000): média 500,5 ms, variância
+// amostral n(n + 1) / 12, mediana 500 ms e p90 900 ms
+static void test_uniform() {
+    const metrics_summary_t *all;
+
+    printf("1 a 1000 ms embaralhados\n");
+    metrics_reset(test_now);
+    for (uint i = 0; i < 1000; i++) {
+        uint value_ms = (i * 7919) % 1000 + 1;
+        test_answer(value_ms % metrics_colors, 1 + value_ms % 3, value_ms * 1000, value_ms % 10 != 0);
+    }
+
+    all = metrics_overall();
+    test_check(all->stats.count == 1000, "%lu amostras", (unsigned long) all->stats.count);
+    test_check(test_near(all->stats.mean, 500500, 1), "média %.1f us", all->stats.mean);
+    float variance = metrics_variance(&all->stats);
+    test_check(test_near(variance, 1000.0f * 1001 / 12 * 1e6f, 83416667 * 1e-4f), "variância %.0f", variance);
+    test_check(all->stats.min_us == 1000 && all->stats.max_us == 1000000, "extremos %lu e %lu",
+               (unsigned long) all->stats.min_us, (unsigned long) all->stats.max_us);
+
+    // P² converge para o quantil; com 1000 amostras uniformes fica a poucos por cento do exato
+    float median = metrics_quantile(&all->median);
+    float p90 = metrics_quantile(&all->p90);
+    test_check(test_near(median, 500000, 20000), "mediana %.0f us", median);
+    test_check(test_near(p90, 900000, 20000), "p90 %.0f us", p90);
+
+    // Faixas de 100 ms: 1-99 ms na primeira, 100 por faixa até 999 ms e 1000 ms sozinho na faixa 10
+    test_check(all->histogram[0] == 99, "faixa 0 com %u", all->histogram[0]);
+    for (uint bin = 1; bin < 10; bin++) {
+        test_check(all->histogram[bin] == 100, "faixa %u com %u", bin, all->histogram[bin]);
+    }
+    test_check(all->histogram[10] == 1, "faixa 10 com %u", all->histogram[10]);
+    test_check(all->errors == 100, "%lu erros", (unsigned long) all->errors);
+
+    uint32_t colors = 0;
+    for (uint8_t color = 0; color < metrics_colors; color++) {
+        colors += metrics_color(color)->stats.count;
+    }
+    test_check(colors == 1000 && metrics_color(metrics_colors) == NULL, "%lu amostras nas cores",
+               (unsigned long) colors);
+    // Cor 0: múltiplos de 4 ms, de 4 a 1000 (média 502 ms)
+    test_check(test_near(metrics_color(0)->stats.mean, 502000, 1), "média da cor 0 %.1f us",
+               metrics_color(0)->stats.mean);
+    // Rodada 1: múltiplos de 3 ms, de 3 a 999 (média 501 ms)
+    test_check(test_near(metrics_round(1)->mean, 501000, 1), "média da rodada 1 %.1f us", metrics_round(1)->mean);
+    test_check(metrics_round(4)->count == 0 && metrics_round(0) == NULL, "rodadas sem respostas");
+}
+
+// Menos de cinco amostras: os quantis vêm das próprias amostras ordenadas
+static void test_few() {
+    const metrics_summary_t *all;
+
+    printf("poucas amostras\n");
+    metrics_reset(test_now);
+    all = metrics_overall();
+    test_check(metrics_quantile(&all->median) == 0 && metrics_variance(&all->stats) == 0, "sessão vazia");
+
+    test_answer(0, 1, 300000, true);
+    test_check(metrics_variance(&all->stats) == 0, "variância de uma amostra");
+    test_answer(1, 1, 100000, true);
+    test_answer(2, 1, 200000, true);
+    test_check(test_near(metrics_quantile(&all->median), 200000, 0), "mediana %.0f us",
+               metrics_quantile(&all->median));
+    test_check(test_near(metrics_quantile(&all->p90), 300000, 0), "p90 %.0f us", metrics_quantile(&all->p90));
+    test_check(test_near(metrics_variance(&all->stats), 1e10f, 1e3f), "variância %.0f",
+               metrics_variance(&all->stats));
+
+    // Acima da última faixa: acumula nela
+    test_answer(3, 2, 5000000, true);
+    test_check(all->histogram[metrics_histogram_bins - 1] == 1, "última faixa com %u",
+               all->histogram[metrics_histogram_bins - 1]);
+}
+
+// Respostas que não chegaram a ser processadas não se perdem até encher a fila
+static void test_pending() {
+    printf("fila de amostras\n");
+    metrics_reset(test_now);
+    for (uint i = 0; i < metrics_pending_length + 4; i++) {
+        metrics_playback_end(test_now);
+        test_now += 1000;
+        metrics_input(0, 1, test_now, true);
+    }
+    metrics_process();
+    test_check(metrics_overall()->stats.count == metrics_pending_length, "%lu amostras",
+               (unsigned long) metrics_overall()->stats.count);
+}
+
+int main() {
+    test_uniform();
+    test_few();
+    test_pending();
+
+    printf(test_failures ? "%d falhas\n" : "ok\n", test_failures);
+    return test_failures ? 1 : 0;
+}
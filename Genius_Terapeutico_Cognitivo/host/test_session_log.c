@@ -0,0 +1,167 @@
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "inc/hal.h"
+#include "inc/hal_host.h"
+#include "inc/session_log.h"
+
+// Verificação do registro de partidas sobre a flash simulada (inc/hal_host.c): busca da cabeça na
+// inicialização, volta ao primeiro setor, registros apagados ou interrompidos e a gravação de uma
+// página inteira por vez. Reiniciar a placa é chamar session_log_init() de novo (a RAM se perde)
+
+static int test_failures = 0;
+
+#define test_check(condition, ...) do { \
+        if (!(condition)) { \
+            printf("  FALHOU (linha %d): ", __LINE__); \
+            printf(__VA_ARGS__); \
+            printf("\n"); \
+            test_failures++; \
+        } \
+    } while (0)
+
+static void test_erase_all() {
+    hal_flash_erase(0, hal_flash_data_size);
+    session_log_init();
+}
+
+// Acrescenta count partidas (a duração identifica cada uma) e grava as páginas completas
+static uint32_t test_add(uint count, uint32_t first_duration) {
+    uint32_t serial = 0;
+
+    for (uint i = 0; i < count; i++) {
+        session_log_record_t record = { .duration_ms = first_duration + i, .total_rounds = 10 };
+        session_log_add(&record);
+        serial = record.serial;
+        if (session_log_pending()) {
+            session_log_commit();
+        }
+    }
+    return serial;
+}
+
+// As count partidas mais recentes têm números consecutivos terminando em last_serial
+static bool test_sequence(uint count, uint32_t last_serial) {
+    session_log_record_t record;
+
+    for (uint age = 0; age < count; age++) {
+        if (!session_log_read(age, &record) || record.serial != last_serial - age) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Grava um registro interrompido na posição: número escrito, restante ainda apagado (CRC inválido)
+static void test_tear(uint position) {
+    uint8_t page[hal_flash_page_size];
+    uint32_t offset = position * session_log_record_size;
+    uint32_t page_offset = offset - offset % hal_flash_page_size;
+    uint32_t serial = 0x1234;
+
+    memset(page, 0xFF, sizeof(page));
+    memcpy(&page[offset - page_offset], &serial, sizeof(serial));
+    hal_flash_program(page_offset, page, sizeof(page));
+}
+
+static void test_blank() {
+    printf("flash apagada\n");
+    test_erase_all();
+    test_check(session_log_count() == 0, "%u registros", session_log_count());
+
+    uint32_t last = test_add(3, 100);
+    test_check(last == 3, "número %lu", (unsigned long) last);
+    session_log_flush();
+    session_log_init();
+    test_check(session_log_count() == 3, "%u registros depois de reiniciar", session_log_count());
+    test_check(test_sequence(3, 3), "sequência 1-3 após reiniciar");
+}
+
+static void test_full_pages() {
+    printf("uma gravação por página\n");
+    test_erase_all();
+    uint32_t pages = hal_host_flash_stats()->pages;
+
+    test_add(session_log_per_page - 1, 0);
+    test_check(hal_host_flash_stats()->pages == pages, "página incompleta foi gravada");
+    test_check(session_log_count() == session_log_per_page - 1, "%u registros", session_log_count());
+
+    test_add(1, 0);
+    test_check(hal_host_flash_stats()->pages == pages + 1, "%lu páginas gravadas",
+               (unsigned long) (hal_host_flash_stats()->pages - pages));
+
+    // Antes do repouso a página incompleta vai para a flash; depois ela é completada uma vez só
+    test_add(5, 0);
+    session_log_flush();
+    test_add(session_log_per_page - 5, 0);
+    test_check(hal_host_flash_stats()->pages == pages + 3, "%lu páginas gravadas",
+               (unsigned long) (hal_host_flash_stats()->pages - pages));
+    session_log_init();
+    test_check(test_sequence(2 * session_log_per_page, 2 * session_log_per_page), "sequência após reiniciar");
+}
+
+static void test_wrap() {
+    printf("volta ao primeiro setor\n");
+    test_erase_all();
+
+    // Mais de uma volta completa, terminando no meio de uma página do segundo setor
+    uint total = session_log_capacity + session_log_per_sector + 3 * session_log_per_page + 7;
+    uint32_t last = test_add(total, 0);
+    session_log_flush();
+    uint stored = session_log_count();
+
+    session_log_init();
+    test_check(session_log_count() == stored, "%u registros, esperados %u", session_log_count(), stored);
+    test_check(stored > session_log_capacity - session_log_per_sector && stored <= session_log_capacity,
+               "%u registros após a volta", stored);
+    test_check(test_sequence(stored, last), "sequência até %lu após reiniciar", (unsigned long) last);
+
+    uint32_t next = test_add(1, 0);
+    test_check(next == last + 1, "número %lu depois de %lu", (unsigned long) next, (unsigned long) last);
+}
+
+static void test_torn() {
+    session_log_record_t record;
+
+    printf("registro interrompido no meio do setor\n");
+    test_erase_all();
+    uint32_t last = test_add(20, 0);
+    session_log_flush();
+    test_tear(20);
+
+    session_log_init();
+    test_check(session_log_count() == 21, "%u registros", session_log_count());
+    test_check(!session_log_read(0, &record), "registro interrompido lido como válido");
+    uint32_t next = test_add(1, 0);
+    test_check(next == last + 1, "número %lu depois de %lu", (unsigned long) next, (unsigned long) last);
+    session_log_flush();
+    session_log_init();
+    test_check(session_log_read(0, &record) && record.serial == next, "registro novo perdido");
+    test_check(session_log_read(2, &record) && record.serial == last, "registro anterior perdido");
+
+    printf("registro interrompido no início de um setor\n");
+    test_erase_all();
+    last = test_add(session_log_per_sector, 0);
+    test_tear(session_log_per_sector);
+
+    session_log_init();
+    test_check(session_log_count() == session_log_per_sector, "%u registros", session_log_count());
+    next = test_add(session_log_per_page, 0);
+    test_check(next == last + session_log_per_page, "número %lu depois de %lu", (unsigned long) next,
+               (unsigned long) last);
+    session_log_init();
+    test_check(test_sequence(session_log_per_sector + session_log_per_page, next), "sequência até %lu",
+               (unsigned long) next);
+}
+
+int main() {
+    hal_init();
+
+    test_blank();
+    test_full_pages();
+    test_wrap();
+    test_torn();
+
+    printf(test_failures ? "%d falhas\n" : "ok\n", test_failures);
+    return test_failures ? 1 : 0;
+}
@@ -0,0 +1,70 @@
+#include "pico/stdlib.h"
+#include "adpcm.h"
+
+// Tabelas do padrão IMA (as mesmas do WAV IMA-ADPCM), para que clipes gerados por outras
+// ferramentas também toquem
+
+static const uint16_t adpcm_steps[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+    337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+static const int8_t adpcm_index_change[8] = { -1, -1, -1, -1, 2, 4, 6, 8 };
+
+// Reconstrói a próxima amostra a partir do código de 4 bits (bit 3 = sinal)
+int16_t adpcm_decode(adpcm_state_t *state, uint8_t nibble) {
+    int32_t step = adpcm_steps[state->index];
+    int32_t delta = step >> 3;
+
+    if (nibble & 4) {
+        delta += step;
+    }
+    if (nibble & 2) {
+        delta += step >> 1;
+    }
+    if (nibble & 1) {
+        delta += step >> 2;
+    }
+
+    int32_t predictor = state->predictor + ((nibble & 8) ? -delta : delta);
+    if (predictor > INT16_MAX) {
+        predictor = INT16_MAX;
+    } else if (predictor < INT16_MIN) {
+        predictor = INT16_MIN;
+    }
+
+    int index = state->index + adpcm_index_change[nibble & 7];
+    state->index = index < 0 ? 0 : (index > 88 ? 88 : index);
+    state->predictor = predictor;
+    return predictor;
+}
+
+// Código de 4 bits mais próximo da amostra; o estado avança como no decodificador, então os
+// dois lados nunca divergem
+uint8_t adpcm_encode(adpcm_state_t *state, int16_t sample) {
+    int32_t step = adpcm_steps[state->index];
+    int32_t difference = sample - state->predictor;
+    uint8_t nibble = 0;
+
+    if (difference < 0) {
+        nibble = 8;
+        difference = -difference;
+    }
+    if (difference >= step) {
+        nibble |= 4;
+        difference -= step;
+    }
+    if (difference >= step >> 1) {
+        nibble |= 2;
+        difference -= step >> 1;
+    }
+    if (difference >= step >> 2) {
+        nibble |= 1;
+    }
+
+    adpcm_decode(state, nibble);
+    return nibble;
+}
@@ -0,0 +1,16 @@
+#include "pico/stdlib.h"
+
+#ifndef adpcm_inc_h
+#define adpcm_inc_h
+
+// IMA-ADPCM: 4 bits por amostra de 16 bits. Os clipes começam com preditor 0 e índice 0, e as
+// amostras vêm no nibble baixo de cada byte antes do alto
+typedef struct {
+    int16_t predictor; // Última amostra reconstruída
+    uint8_t index;     // Posição na tabela de passos (0 a 88)
+} adpcm_state_t;
+
+extern int16_t adpcm_decode(adpcm_state_t *state, uint8_t nibble);
+extern uint8_t adpcm_encode(adpcm_state_t *state, int16_t sample);
+
+#endif
@@ -0,0 +1,102 @@
+#include "pico/stdlib.h"
+#include "assets.h"
+
+// Gerado por host/asset_pack.c (alvo assets do CMake); não edite. Para refazer:
+//   asset_pack inc/assets ssd1306_font=assets/fonte_8x8.bdf icone_genius=rle:assets/genius.pbm
+
+static const uint8_t ssd1306_font_glyphs[968] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x14, 0x12, 0x11, 0x12, 0x14, 0x78, 0x00,
+    0x7F, 0x49, 0x49, 0x49, 0x49, 0x49, 0x7F, 0x00, 0x7E, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x00,
+    0x7F, 0x41, 0x41, 0x41, 0x41, 0x41, 0x7E, 0x00, 0x7F, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00,
+    0x7F, 0x09, 0x09, 0x09, 0x09, 0x01, 0x01, 0x00, 0x7F, 0x41, 0x41, 0x41, 0x51, 0x51, 0x73, 0x00,
+    0x7F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x41, 0x41, 0x3F, 0x01, 0x01, 0x01, 0x00, 0x00, 0x7F, 0x08, 0x08, 0x14, 0x22, 0x41, 0x00,
+    0x7F, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x7F, 0x02, 0x04, 0x08, 0x04, 0x02, 0x7F, 0x00,
+    0x7F, 0x02, 0x04, 0x08, 0x10, 0x20, 0x7F, 0x00, 0x3E, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3E, 0x00,
+    0x7F, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E, 0x00, 0x3E, 0x41, 0x41, 0x49, 0x51, 0x61, 0x7E, 0x00,
+    0x7F, 0x11, 0x11, 0x11, 0x31, 0x51, 0x0E, 0x00, 0x46, 0x49, 0x49, 0x49, 0x49, 0x30, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x7F, 0x01, 0x01, 0x01, 0x00, 0x3F, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3F, 0x00,
+    0x0F, 0x10, 0x20, 0x40, 0x20, 0x10, 0x0F, 0x00, 0x7F, 0x20, 0x10, 0x08, 0x10, 0x20, 0x7F, 0x00,
+    0x00, 0x41, 0x22, 0x14, 0x14, 0x22, 0x41, 0x00, 0x01, 0x02, 0x04, 0x78, 0x04, 0x02, 0x01, 0x00,
+    0x41, 0x61, 0x59, 0x45, 0x43, 0x41, 0x00, 0x00, 0x3E, 0x41, 0x41, 0x49, 0x41, 0x41, 0x3E, 0x00,
+    0x00, 0x00, 0x42, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x30, 0x49, 0x49, 0x49, 0x49, 0x46, 0x00, 0x00,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x36, 0x00, 0x3F, 0x20, 0x20, 0x78, 0x20, 0x20, 0x00, 0x00,
+    0x4F, 0x49, 0x49, 0x49, 0x49, 0x30, 0x00, 0x00, 0x3F, 0x48, 0x48, 0x48, 0x48, 0x48, 0x30, 0x00,
+    0x01, 0x01, 0x01, 0x61, 0x31, 0x0D, 0x03, 0x00, 0x36, 0x49, 0x49, 0x49, 0x49, 0x49, 0x36, 0x00,
+    0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x14, 0x7F, 0x14, 0x7F, 0x14, 0x00, 0x00,
+    0x00, 0x24, 0x2A, 0x7F, 0x2A, 0x12, 0x00, 0x00, 0x00, 0x23, 0x13, 0x08, 0x64, 0x62, 0x00, 0x00,
+    0x00, 0x36, 0x49, 0x55, 0x22, 0x50, 0x00, 0x00, 0x00, 0x00, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1C, 0x22, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x22, 0x1C, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x2A, 0x1C, 0x2A, 0x08, 0x00, 0x00, 0x00, 0x08, 0x08, 0x3E, 0x08, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x08, 0x04, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x36, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x14, 0x22, 0x41, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x00,
+    0x00, 0x00, 0x41, 0x22, 0x14, 0x08, 0x00, 0x00, 0x00, 0x02, 0x01, 0x51, 0x09, 0x06, 0x00, 0x00,
+    0x00, 0x32, 0x49, 0x79, 0x41, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x41, 0x41, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x04, 0x08, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x41, 0x41, 0x7F, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x02, 0x01, 0x02, 0x04, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x54, 0x54, 0x54, 0x78, 0x00, 0x00,
+    0x00, 0x7F, 0x48, 0x44, 0x44, 0x38, 0x00, 0x00, 0x00, 0x38, 0x44, 0x44, 0x44, 0x20, 0x00, 0x00,
+    0x00, 0x38, 0x44, 0x44, 0x48, 0x7F, 0x00, 0x00, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x00,
+    0x00, 0x08, 0x7E, 0x09, 0x01, 0x02, 0x00, 0x00, 0x00, 0x18, 0xA4, 0xA4, 0xA4, 0x7C, 0x00, 0x00,
+    0x00, 0x7F, 0x08, 0x04, 0x04, 0x78, 0x00, 0x00, 0x00, 0x00, 0x44, 0x7D, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x80, 0x84, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x10, 0x28, 0x44, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x41, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x04, 0x18, 0x04, 0x78, 0x00, 0x00,
+    0x00, 0x7C, 0x08, 0x04, 0x04, 0x78, 0x00, 0x00, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x00,
+    0x00, 0xFC, 0x24, 0x24, 0x24, 0x18, 0x00, 0x00, 0x00, 0x18, 0x24, 0x24, 0x24, 0xFC, 0x00, 0x00,
+    0x00, 0x7C, 0x08, 0x04, 0x04, 0x08, 0x00, 0x00, 0x00, 0x48, 0x54, 0x54, 0x54, 0x20, 0x00, 0x00,
+    0x00, 0x04, 0x3F, 0x44, 0x40, 0x20, 0x00, 0x00, 0x00, 0x3C, 0x40, 0x40, 0x20, 0x7C, 0x00, 0x00,
+    0x00, 0x1C, 0x20, 0x40, 0x20, 0x1C, 0x00, 0x00, 0x00, 0x3C, 0x40, 0x30, 0x40, 0x3C, 0x00, 0x00,
+    0x00, 0x44, 0x28, 0x10, 0x28, 0x44, 0x00, 0x00, 0x00, 0x1C, 0xA0, 0xA0, 0xA0, 0x7C, 0x00, 0x00,
+    0x00, 0x44, 0x64, 0x54, 0x4C, 0x44, 0x00, 0x00, 0x00, 0x00, 0x08, 0x36, 0x41, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x36, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x08, 0x08, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x26, 0x29, 0x29, 0x2F, 0x00, 0x00,
+    0x00, 0x00, 0x26, 0x29, 0x29, 0x26, 0x00, 0x00, 0x00, 0xF8, 0x25, 0x26, 0x24, 0xF8, 0x00, 0x00,
+    0x00, 0xF8, 0x24, 0x26, 0x25, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x26, 0x25, 0x26, 0xF8, 0x00, 0x00,
+    0x00, 0xFA, 0x25, 0x26, 0x25, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x41, 0xC1, 0xC1, 0x22, 0x00, 0x00,
+    0x00, 0xFC, 0x84, 0x86, 0x85, 0x84, 0x00, 0x00, 0x00, 0xFC, 0x86, 0x85, 0x86, 0x84, 0x00, 0x00,
+    0x00, 0x00, 0x84, 0xFE, 0x85, 0x00, 0x00, 0x00, 0x00, 0x78, 0x84, 0x86, 0x85, 0x78, 0x00, 0x00,
+    0x00, 0x78, 0x86, 0x85, 0x86, 0x78, 0x00, 0x00, 0x00, 0x7A, 0x85, 0x86, 0x85, 0x78, 0x00, 0x00,
+    0x00, 0x7C, 0x80, 0x82, 0x81, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x55, 0x56, 0x54, 0x78, 0x00, 0x00,
+    0x00, 0x20, 0x54, 0x56, 0x55, 0x78, 0x00, 0x00, 0x00, 0x20, 0x56, 0x55, 0x56, 0x78, 0x00, 0x00,
+    0x00, 0x22, 0x55, 0x56, 0x55, 0x78, 0x00, 0x00, 0x00, 0x38, 0x44, 0xC4, 0xC4, 0x20, 0x00, 0x00,
+    0x00, 0x38, 0x54, 0x56, 0x55, 0x18, 0x00, 0x00, 0x00, 0x38, 0x56, 0x55, 0x56, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x44, 0x7E, 0x41, 0x00, 0x00, 0x00, 0x00, 0x38, 0x44, 0x46, 0x45, 0x38, 0x00, 0x00,
+    0x00, 0x38, 0x46, 0x45, 0x46, 0x38, 0x00, 0x00, 0x00, 0x3A, 0x45, 0x46, 0x45, 0x38, 0x00, 0x00,
+    0x00, 0x3C, 0x40, 0x42, 0x21, 0x7C, 0x00, 0x00,
+};
+
+static const uint8_t ssd1306_font_index[256] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33,
+    0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+    0x3A, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F,
+    0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x61, 0x62, 0x63, 0x64, 0x00, 0x00, 0x00, 0x65, 0x00, 0x66, 0x67, 0x00, 0x00, 0x68, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x69, 0x6A, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x6D, 0x6E, 0x6F, 0x70, 0x00, 0x00, 0x00, 0x71, 0x00, 0x72, 0x73, 0x00, 0x00, 0x74, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x75, 0x76, 0x77, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const ssd1306_font_t ssd1306_font = { 8, 8, ssd1306_font_glyphs, ssd1306_font_index };
+
+static const uint8_t icone_genius_data[102] = {
+    0xFE, 0x00, 0x04, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFE, 0xFC, 0xFD, 0xFE, 0xFF, 0x00, 0xFD, 0xFE,
+    0xFE, 0xFC, 0x04, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0xFD, 0x00, 0x00, 0x78, 0xFA, 0x7F, 0x05, 0x1F,
+    0x0F, 0x87, 0xE3, 0x31, 0x11, 0xFF, 0x18, 0x05, 0x11, 0x31, 0xE3, 0x87, 0x0F, 0x1F, 0xFA, 0x7F,
+    0x00, 0x78, 0xFF, 0x00, 0x00, 0x1E, 0xFA, 0xFE, 0x05, 0xF8, 0xF0, 0xE1, 0xC7, 0x8C, 0x88, 0xFF,
+    0x18, 0x05, 0x88, 0x8C, 0xC7, 0xE1, 0xF0, 0xF8, 0xFA, 0xFE, 0x00, 0x1E, 0xFD, 0x00, 0x04, 0x01,
+    0x03, 0x07, 0x0F, 0x1F, 0xFE, 0x3F, 0xFD, 0x7F, 0xFF, 0x00, 0xFD, 0x7F, 0xFE, 0x3F, 0x04, 0x1F,
+    0x0F, 0x07, 0x03, 0x01, 0xFE, 0x00,
+};
+
+const ssd1306_packed_sprite_t icone_genius = { 32, 32, 102, icone_genius_data };
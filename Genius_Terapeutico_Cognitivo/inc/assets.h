@@ -0,0 +1,13 @@
+#include "pico/stdlib.h"
+#include "ssd1306_i2c.h"
+
+#ifndef assets_inc_h
+#define assets_inc_h
+
+// Gerado por host/asset_pack.c (alvo assets do CMake); não edite. Para refazer:
+//   asset_pack inc/assets ssd1306_font=assets/fonte_8x8.bdf icone_genius=rle:assets/genius.pbm
+
+extern const ssd1306_font_t ssd1306_font; // 8x8, 121 glifos
+extern const ssd1306_packed_sprite_t icone_genius; // 32x32, RLE
+
+#endif
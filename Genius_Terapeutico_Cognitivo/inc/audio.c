@@ -0,0 +1,192 @@
+#include "pico/stdlib.h"
+#include "hal.h"
+#include "adpcm.h"
+#include "audio.h"
+
+// Fila circular de notas: audio_play() escreve em audio_head, o alarme consome em audio_tail
+static audio_note_t audio_queue[audio_queue_length];
+static volatile uint audio_head = 0;
+static volatile uint audio_tail = 0;
+static volatile bool audio_playing = false;
+static int audio_alarm = 0;
+static uint audio_gpio;
+
+// Clipe em andamento (as notas esperam o fim dele) e o que espera as notas já enfileiradas
+typedef enum {
+    audio_phase_ramp_in,  // Sobe do nível 0 ao meio do ciclo, para a componente contínua não estalar
+    audio_phase_clip,
+    audio_phase_ramp_out
+} audio_phase_t;
+
+static const audio_clip_t *volatile audio_clip = NULL;
+static const audio_clip_t *volatile audio_clip_pending = NULL;
+static uint8_t audio_clip_volume;
+static uint8_t audio_pending_volume;
+static audio_phase_t audio_phase;
+static adpcm_state_t audio_decoder;
+static uint32_t audio_position; // Próxima amostra do clipe
+static uint audio_ramp;
+
+static void audio_start_clip(const audio_clip_t *clip, uint8_t volume);
+
+// Executado pela interrupção do alarme: troca para a próxima nota da fila ou silencia o buzzer
+static int64_t audio_alarm_callback() {
+    if (audio_tail == audio_head) {
+        hal_pwm_level(audio_gpio, 0);
+        audio_playing = false;
+        if (audio_clip_pending) {
+            audio_start_clip(audio_clip_pending, audio_pending_volume);
+        }
+        return 0;
+    }
+
+    const audio_note_t *note = &audio_queue[audio_tail % audio_queue_length];
+    hal_pwm_set(audio_gpio, note->div_int, note->div_frac, note->level);
+    audio_tail++;
+
+    // Valor negativo: reagenda a partir do instante previsto, sem acumular atraso entre notas
+    return -(int64_t) note->duration_us;
+}
+
+// Próximas amostras do clipe em níveis de PWM (em interrupção, a cada hal_pcm_block amostras):
+// decodifica o ADPCM da flash, aplica o volume e centra no meio do ciclo
+static uint audio_refill(uint16_t *levels, uint count) {
+    const int32_t middle = (hal_pwm_wrap + 1) / 2;
+    const audio_clip_t *clip = audio_clip;
+    uint n = 0;
+
+    while (n < count) {
+        if (audio_phase == audio_phase_ramp_in) {
+            levels[n++] = middle * ++audio_ramp / audio_ramp_samples;
+            if (audio_ramp == audio_ramp_samples) {
+                audio_phase = audio_phase_clip;
+            }
+        } else if (audio_phase == audio_phase_clip) {
+            if (audio_position == clip->samples) {
+                audio_phase = audio_phase_ramp_out;
+                continue;
+            }
+            uint8_t nibble = clip->data[audio_position / 2] >> (4 * (audio_position & 1));
+            int32_t sample = adpcm_decode(&audio_decoder, nibble & 0xF);
+            levels[n++] = middle + sample * audio_clip_volume / 100 / 16;
+            audio_position++;
+        } else {
+            if (audio_ramp == 0) {
+                break;
+            }
+            levels[n++] = middle * --audio_ramp / audio_ramp_samples;
+        }
+    }
+    return n;
+}
+
+// Fim do clipe (em interrupção): as notas enfileiradas durante ele começam agora
+static void audio_clip_done() {
+    audio_clip = NULL;
+    if (audio_tail != audio_head && !audio_playing) {
+        audio_playing = true;
+        audio_alarm = hal_alarm_start(0, audio_alarm_callback);
+    }
+}
+
+static void audio_start_clip(const audio_clip_t *clip, uint8_t volume) {
+    audio_clip_pending = NULL;
+    audio_clip = clip;
+    audio_clip_volume = volume > 100 ? 100 : volume;
+    audio_phase = audio_phase_ramp_in;
+    audio_decoder = (adpcm_state_t) { 0, 0 };
+    audio_position = 0;
+    audio_ramp = 0;
+    hal_pcm_start(clip->sample_rate, audio_refill, audio_clip_done);
+}
+
+// Configura o pino do buzzer como PWM, inicialmente em silêncio. As notas trocam nos alarmes do
+// núcleo que chamou hal_alarm_init() (ou no núcleo 0, se ninguém chamou); os clipes são preenchidos
+// na interrupção de DMA do núcleo que chamar esta função
+void audio_init(uint gpio) {
+    audio_gpio = gpio;
+    hal_pwm_init(gpio);
+    hal_pcm_init(gpio);
+}
+
+// Enfileira uma nota (frequência 0 = pausa) com volume de 0 a 100% e retorna imediatamente.
+// Retorna false se a fila estiver cheia
+bool audio_play(uint32_t frequency, uint32_t duration_ms, uint8_t volume) {
+    if (audio_head - audio_tail >= audio_queue_length) {
+        return false;
+    }
+
+    audio_note_t *note = &audio_queue[audio_head % audio_queue_length];
+    note->duration_us = duration_ms * 1000;
+
+    if (frequency == 0 || volume == 0) {
+        note->div_int = 1;
+        note->div_frac = 0;
+        note->level = 0;
+    } else {
+        // Divisor em dezesseis avos (8.4 bits) para o wrap fixo, limitado à faixa do hardware
+        uint32_t divider = (uint32_t) (((uint64_t) hal_clock_hz() * 16 + frequency * (hal_pwm_wrap + 1) / 2) /
+                                       (frequency * (hal_pwm_wrap + 1)));
+        if (divider < 16) {
+            divider = 16;
+        } else if (divider > 0xFFF) {
+            divider = 0xFFF;
+        }
+
+        note->div_int = divider >> 4;
+        note->div_frac = divider & 0xF;
+        note->level = ((hal_pwm_wrap + 1) * (volume > 100 ? 100 : volume)) / 100;
+    }
+    audio_head++;
+
+    if (!audio_playing && !audio_clip && !audio_clip_pending) {
+        audio_playing = true;
+        audio_alarm = hal_alarm_start(0, audio_alarm_callback);
+    }
+    return true;
+}
+
+// Toca um clipe com volume de 0 a 100% da amplitude gravada e retorna imediatamente. Ele começa
+// quando a fila de notas esvaziar; as notas enfileiradas enquanto ele toca esperam o seu fim. Um
+// clipe novo substitui o que ainda não terminou
+void audio_play_clip(const audio_clip_t *clip, uint8_t volume) {
+    uint32_t interrupts = hal_irq_disable();
+    if (audio_clip) {
+        hal_pcm_stop();
+        audio_clip = NULL;
+    }
+    if (audio_playing) {
+        audio_clip_pending = clip;
+        audio_pending_volume = volume;
+    } else {
+        audio_start_clip(clip, volume);
+    }
+    hal_irq_restore(interrupts);
+}
+
+// Indica se ainda há notas ou clipes tocando ou na fila
+bool audio_busy() {
+    return audio_playing || audio_clip || audio_clip_pending;
+}
+
+// Aguarda o fim de todas as notas e clipes enfileirados
+void audio_wait() {
+    while (audio_busy()) {
+        tight_loop_contents();
+    }
+}
+
+// Interrompe a nota ou o clipe atual e descarta a fila
+void audio_stop() {
+    uint32_t interrupts = hal_irq_disable();
+    hal_pcm_stop();
+    audio_clip = NULL;
+    audio_clip_pending = NULL;
+    if (audio_playing) {
+        hal_alarm_cancel(audio_alarm);
+        audio_playing = false;
+    }
+    audio_tail = audio_head;
+    hal_pwm_level(audio_gpio, 0);
+    hal_irq_restore(interrupts);
+}
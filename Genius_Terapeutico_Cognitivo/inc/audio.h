@@ -0,0 +1,38 @@
+#include "pico/stdlib.h"
+
+#ifndef audio_inc_h
+#define audio_inc_h
+
+#define audio_queue_length 32 // Número máximo de notas aguardando (potência de 2)
+#define audio_ramp_samples 64 // Amostras das rampas até o meio do ciclo antes e depois de um clipe
+
+// Nota pronta para tocar: divisor e nível já calculados na hora de enfileirar, para que a
+// interrupção só precise copiar registradores. O wrap é o comum (hal_pwm_wrap): o buzzer divide
+// o slice com o LED verde e a nota não pode mudar a escala do brilho
+typedef struct {
+    uint8_t div_int;
+    uint8_t div_frac;
+    uint16_t level;       // 0 = pausa (buzzer em silêncio)
+    uint32_t duration_us;
+} audio_note_t;
+
+// Som gravado em IMA-ADPCM (adpcm.h), tocado direto da flash. Gerado por host/adpcm_encode.c
+typedef struct {
+    const uint8_t *data;  // Dois códigos por byte, o primeiro no nibble baixo
+    uint32_t samples;
+    uint16_t sample_rate; // 8 a 16 kHz
+} audio_clip_t;
+
+// Duração de um clipe ao tocar, incluindo as rampas de entrada e saída
+static inline uint32_t audio_clip_ms(const audio_clip_t *clip) {
+    return (uint32_t) ((uint64_t) (clip->samples + 2 * audio_ramp_samples) * 1000 / clip->sample_rate);
+}
+
+extern void audio_init(uint gpio);
+extern bool audio_play(uint32_t frequency, uint32_t duration_ms, uint8_t volume);
+extern void audio_play_clip(const audio_clip_t *clip, uint8_t volume);
+extern bool audio_busy();
+extern void audio_wait();
+extern void audio_stop();
+
+#endif
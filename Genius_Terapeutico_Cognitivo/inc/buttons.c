@@ -0,0 +1,141 @@
+#include "pico/stdlib.h"
+#include "hal.h"
+#include "buttons.h"
+
+// Estado filtrado de cada botão: só aceita nova borda depois de debounce_us da última aceita
+typedef struct {
+    uint pin;
+    bool pressed;
+    uint64_t changed_us;
+} button_state_t;
+
+static button_state_t buttons_state[buttons_max_pins];
+static uint buttons_count = 0;
+static uint32_t buttons_debounce_us;
+static buttons_notify_t buttons_notify = NULL;
+
+// Fila de produtor único (interrupção) e consumidor único (tarefa): cada índice tem um só escritor
+static button_event_t buttons_queue[buttons_queue_length];
+static volatile uint buttons_head = 0;
+static volatile uint buttons_tail = 0;
+static volatile uint32_t buttons_overflow = 0;
+
+static void buttons_push(button_state_t *button, uint64_t timestamp_us) {
+    if (buttons_head - buttons_tail >= buttons_queue_length) {
+        buttons_overflow++;
+        return;
+    }
+
+    button_event_t *event = &buttons_queue[buttons_head % buttons_queue_length];
+    event->pin = button->pin;
+    event->pressed = button->pressed;
+    event->timestamp_us = timestamp_us;
+    hal_barrier(); // O evento precisa estar completo antes de o consumidor ver o novo head
+    buttons_head++;
+
+    if (buttons_notify) {
+        buttons_notify();
+    }
+}
+
+// Interrupção de borda: o carimbo de tempo é tirado antes de qualquer outra coisa
+static void buttons_irq_callback(uint gpio, uint32_t events) {
+    uint64_t now = hal_time_us();
+
+    for (uint i = 0; i < buttons_count; i++) {
+        button_state_t *button = &buttons_state[i];
+        if (button->pin != gpio) {
+            continue;
+        }
+
+        // Bordas dentro da janela de debounce são repiques da última borda aceita
+        if (now - button->changed_us < buttons_debounce_us) {
+            return;
+        }
+
+        // Pull-up: borda de descida = pressionado, de subida = solto
+        bool pressed = (events & hal_edge_fall) != 0;
+        if (pressed == button->pressed) {
+            return;
+        }
+
+        button->pressed = pressed;
+        button->changed_us = now;
+        buttons_push(button, now);
+        return;
+    }
+}
+
+// Configura os pinos (entrada com pull-up) e habilita interrupções nas duas bordas
+void buttons_init(const uint *pins, uint count, uint32_t debounce_us, buttons_notify_t notify) {
+    assert(count <= buttons_max_pins);
+
+    buttons_debounce_us = debounce_us;
+    buttons_notify = notify;
+    buttons_count = count;
+
+    for (uint i = 0; i < count; i++) {
+        hal_gpio_input_pullup(pins[i]);
+
+        buttons_state[i].pin = pins[i];
+        buttons_state[i].pressed = !hal_gpio_get(pins[i]);
+        buttons_state[i].changed_us = 0;
+        hal_gpio_edge_irq(pins[i], buttons_irq_callback);
+    }
+}
+
+// Retira o evento mais antigo da fila; retorna false se ela estiver vazia
+bool buttons_pop(button_event_t *event) {
+    if (buttons_tail == buttons_head) {
+        return false;
+    }
+
+    *event = buttons_queue[buttons_tail % buttons_queue_length];
+    hal_barrier(); // Termina a leitura antes de liberar a posição para o produtor
+    buttons_tail++;
+    return true;
+}
+
+// Corrige botões cujo nível mudou durante a janela de debounce (borda ignorada como repique).
+// Retorna o instante em que a próxima janela termina, ou 0 se nenhuma estiver aberta
+uint64_t buttons_settle() {
+    uint64_t now = hal_time_us();
+    uint64_t next = 0;
+
+    uint32_t interrupts = hal_irq_disable(); // Aqui a tarefa também produz eventos
+    for (uint i = 0; i < buttons_count; i++) {
+        button_state_t *button = &buttons_state[i];
+        uint64_t window_end = button->changed_us + buttons_debounce_us;
+
+        if (now < window_end) {
+            if (next == 0 || window_end < next) {
+                next = window_end;
+            }
+        } else if (!hal_gpio_get(button->pin) != button->pressed) {
+            button->pressed = !button->pressed;
+            button->changed_us = now;
+            buttons_push(button, now);
+        }
+    }
+    hal_irq_restore(interrupts);
+
+    return next;
+}
+
+// Registra uma borda que não passou pela interrupção (a que acorda do modo dormente) como a última
+// aceita, sem gerar evento: a soltura e os repiques seguintes são filtrados normalmente
+void buttons_resync(uint pin, bool pressed, uint64_t timestamp_us) {
+    uint32_t interrupts = hal_irq_disable();
+    for (uint i = 0; i < buttons_count; i++) {
+        if (buttons_state[i].pin == pin) {
+            buttons_state[i].pressed = pressed;
+            buttons_state[i].changed_us = timestamp_us;
+        }
+    }
+    hal_irq_restore(interrupts);
+}
+
+// Quantos eventos foram descartados por fila cheia
+uint32_t buttons_dropped() {
+    return buttons_overflow;
+}
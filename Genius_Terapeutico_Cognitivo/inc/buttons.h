@@ -0,0 +1,25 @@
+#include "pico/stdlib.h"
+
+#ifndef buttons_inc_h
+#define buttons_inc_h
+
+#define buttons_max_pins 4       // Número máximo de botões monitorados
+#define buttons_queue_length 16  // Capacidade da fila de eventos (potência de 2)
+
+// Evento de botão com o instante exato da borda que o gerou
+typedef struct {
+    uint8_t pin;
+    bool pressed;           // true = pressionado, false = solto
+    uint64_t timestamp_us;  // hal_time_us() no momento da interrupção
+} button_event_t;
+
+// Chamada (em contexto de interrupção) sempre que um novo evento entra na fila
+typedef void (*buttons_notify_t)(void);
+
+extern void buttons_init(const uint *pins, uint count, uint32_t debounce_us, buttons_notify_t notify);
+extern bool buttons_pop(button_event_t *event);
+extern uint64_t buttons_settle();
+extern void buttons_resync(uint pin, bool pressed, uint64_t timestamp_us);
+extern uint32_t buttons_dropped();
+
+#endif
@@ -0,0 +1,241 @@
+#include "pico/stdlib.h"
+#include "clips.h"
+
+// Gerado por host/adpcm_encode.c; não edite. Para refazer:
+//   adpcm_encode inc/clips clip_round=tom:1047/90,1568/160 clip_victory=tom:1047/110,1319/110,1568/110,2093/320
+
+static const uint8_t clip_round_data[1000] = {
+    0x70, 0x77, 0xFF, 0xFF, 0x67, 0xA0, 0xBD, 0x40, 0x34, 0xD9, 0x9C, 0x41, 0x14, 0xDA, 0x8A, 0x52,
+    0x82, 0xDA, 0x09, 0x33, 0x92, 0xBD, 0x29, 0x34, 0xB1, 0xAD, 0x38, 0x24, 0xB8, 0x9D, 0x30, 0x14,
+    0xB9, 0x8D, 0x41, 0x02, 0xCA, 0x0A, 0x42, 0x82, 0xDB, 0x19, 0x43, 0x90, 0xAC, 0x29, 0x25, 0xB0,
+    0xBB, 0x40, 0x14, 0xB8, 0x9D, 0x31, 0x04, 0xC9, 0x8A, 0x42, 0x02, 0xCB, 0x0A, 0x53, 0x81, 0xBC,
+    0x29, 0x34, 0xA0, 0xBC, 0x38, 0x25, 0xB8, 0xAC, 0x40, 0x23, 0xD9, 0x9A, 0x41, 0x03, 0xCA, 0x8B,
+    0x53, 0x82, 0xCB, 0x1A, 0x34, 0x91, 0xAD, 0x29, 0x24, 0xA0, 0xBC, 0x30, 0x15, 0xB8, 0x9C, 0x31,
+    0x05, 0xB9, 0x9B, 0x53, 0x02, 0xCB, 0x0A, 0x53, 0x81, 0xDB, 0x19, 0x24, 0xA1, 0xAC, 0x28, 0x24,
+    0xB0, 0xAC, 0x30, 0x15, 0xC8, 0x8B, 0x41, 0x03, 0xDA, 0x8A, 0x43, 0x82, 0xCB, 0x0A, 0x34, 0xA2,
+    0xBC, 0x29, 0x25, 0xB1, 0xAC, 0x38, 0x15, 0xA8, 0xAC, 0x31, 0x05, 0xB9, 0x9B, 0x53, 0x02, 0xDA,
+    0x0A, 0x43, 0x81, 0xCB, 0x1A, 0x34, 0x91, 0xAD, 0x29, 0x34, 0xA8, 0xAD, 0x30, 0x14, 0xB8, 0x9C,
+    0x41, 0x03, 0xCA, 0x8B, 0x53, 0x82, 0xCB, 0x1A, 0x43, 0x92, 0xCC, 0x18, 0x43, 0xA0, 0xAC, 0x38,
+    0x24, 0xB8, 0xAC, 0x40, 0x14, 0xC9, 0x9A, 0x42, 0x02, 0xCA, 0x8A, 0x43, 0x82, 0xDB, 0x09, 0x34,
+    0xA1, 0xBC, 0x28, 0x34, 0xB0, 0xAD, 0x30, 0x24, 0xB9, 0x9D, 0x31, 0x14, 0xCA, 0x9A, 0x43, 0x83,
+    0xDB, 0x1A, 0x43, 0x91, 0xCB, 0x19, 0x34, 0xA1, 0xBD, 0x20, 0x24, 0xB0, 0xAD, 0x31, 0x14, 0xC9,
+    0x9A, 0x41, 0x13, 0xDB, 0x0A, 0x42, 0x82, 0xCB, 0x1A, 0x53, 0x91, 0xAC, 0x29, 0x24, 0xA0, 0xAD,
+    0x30, 0x14, 0xB8, 0xAC, 0x41, 0x13, 0xD9, 0x9A, 0x42, 0x83, 0xDA, 0x89, 0x43, 0x81, 0xCB, 0x19,
+    0x24, 0xA1, 0xBC, 0x38, 0x25, 0xA8, 0x9D, 0x20, 0x14, 0xC8, 0x9A, 0x41, 0x03, 0xCA, 0x8B, 0x53,
+    0x82, 0xCB, 0x1A, 0x43, 0xA2, 0xDB, 0x18, 0x24, 0xA0, 0xAC, 0x38, 0x15, 0xA8, 0xAC, 0x31, 0x14,
+    0xC9, 0x8B, 0x42, 0x03, 0xDB, 0x0A, 0x43, 0x92, 0xDB, 0x19, 0x43, 0xA1, 0xAC, 0x39, 0x24, 0xB0,
+    0x9D, 0x38, 0x15, 0xA9, 0x9C, 0x41, 0x12, 0xCA, 0x8A, 0x42, 0x83, 0xDB, 0x09, 0x43, 0x91, 0xAC,
+    0x19, 0x34, 0xA0, 0xBC, 0x38, 0x25, 0xB8, 0xAC, 0x41, 0x13, 0xC9, 0x8C, 0x41, 0x02, 0xCA, 0x8A,
+    0x53, 0x81, 0xCA, 0x09, 0x24, 0x91, 0xBC, 0x28, 0x34, 0xB0, 0xAD, 0x30, 0x24, 0xB9, 0x9D, 0x41,
+    0x12, 0xCA, 0x8A, 0x42, 0x02, 0xCB, 0x1B, 0x53, 0x6A, 0xF1, 0x3F, 0x86, 0xAD, 0x63, 0xC8, 0x2A,
+    0x06, 0xAC, 0x51, 0xA0, 0x1C, 0x14, 0xCB, 0x50, 0xA1, 0x0C, 0x23, 0xCA, 0x48, 0xA2, 0x8C, 0x33,
+    0xD9, 0x39, 0x94, 0x9C, 0x33, 0xD8, 0x29, 0x03, 0xAC, 0x51, 0xB0, 0x1A, 0x14, 0xAC, 0x31, 0xC2,
+    0x0B, 0x15, 0xBA, 0x58, 0x91, 0x8C, 0x33, 0xCA, 0x38, 0x93, 0x8E, 0x32, 0xC9, 0x29, 0x84, 0xBB,
+    0x53, 0xC0, 0x2A, 0x13, 0xBC, 0x51, 0xA0, 0x1B, 0x14, 0xBB, 0x50, 0xB2, 0x0C, 0x14, 0xC9, 0x38,
+    0xA3, 0x9C, 0x24, 0xC9, 0x39, 0x94, 0xAB, 0x53, 0xB8, 0x2A, 0x04, 0xAC, 0x42, 0xB0, 0x1B, 0x15,
+    0xCB, 0x31, 0xB2, 0x0D, 0x14, 0xBA, 0x58, 0x91, 0x0C, 0x32, 0xCA, 0x38, 0x93, 0x9D, 0x42, 0xC8,
+    0x29, 0x03, 0x9D, 0x41, 0xB0, 0x2B, 0x14, 0xAC, 0x41, 0xA0, 0x0B, 0x15, 0xCA, 0x30, 0xA2, 0x0D,
+    0x23, 0xCA, 0x38, 0x93, 0x8E, 0x32, 0xC9, 0x39, 0x83, 0xAD, 0x43, 0xB8, 0x2B, 0x06, 0xAB, 0x41,
+    0xB0, 0x1B, 0x15, 0xBB, 0x51, 0xA1, 0x0C, 0x23, 0xDA, 0x48, 0x91, 0x8B, 0x43, 0xD9, 0x28, 0x93,
+    0x9C, 0x33, 0xD8, 0x29, 0x03, 0xAD, 0x42, 0xB0, 0x2B, 0x14, 0xAC, 0x50, 0xA0, 0x1B, 0x14, 0xCA,
+    0x30, 0xA2, 0x0D, 0x23, 0xCA, 0x49, 0x93, 0x8D, 0x32, 0xC9, 0x29, 0x84, 0xAB, 0x52, 0xB8, 0x2A,
+    0x05, 0xBB, 0x51, 0xB1, 0x0B, 0x15, 0xCA, 0x40, 0xA1, 0x0B, 0x33, 0xDB, 0x48, 0x92, 0x9C, 0x33,
+    0xC9, 0x39, 0x84, 0x9D, 0x32, 0xC8, 0x29, 0x84, 0xBB, 0x52, 0xB0, 0x2B, 0x05, 0xCA, 0x31, 0xB2,
+    0x0D, 0x14, 0xBA, 0x48, 0x92, 0x8D, 0x23, 0xC9, 0x28, 0x94, 0x8C, 0x32, 0xD8, 0x29, 0x03, 0x9D,
+    0x41, 0xB0, 0x2B, 0x14, 0xAC, 0x41, 0xA0, 0x0B, 0x15, 0xCA, 0x30, 0xA2, 0x8C, 0x24, 0xCA, 0x38,
+    0x93, 0x9D, 0x33, 0xC9, 0x39, 0x84, 0x9D, 0x32, 0xB8, 0x2B, 0x06, 0xBB, 0x42, 0xC1, 0x1A, 0x04,
+    0xBA, 0x50, 0xA1, 0x0C, 0x23, 0xCA, 0x48, 0xA2, 0x8C, 0x33, 0xD9, 0x39, 0x83, 0x9D, 0x42, 0xC8,
+    0x29, 0x03, 0xAC, 0x51, 0xB0, 0x1A, 0x04, 0xBB, 0x51, 0xA1, 0x0C, 0x14, 0xBA, 0x58, 0x91, 0x8C,
+    0x33, 0xCA, 0x38, 0x93, 0x8E, 0x32, 0xC9, 0x29, 0x84, 0xAB, 0x52, 0xB8, 0x2A, 0x14, 0xBC, 0x42,
+    0xB0, 0x1B, 0x15, 0xCA, 0x40, 0xA1, 0x8B, 0x24, 0xCA, 0x48, 0x92, 0x9C, 0x33, 0xC9, 0x39, 0x94,
+    0x9C, 0x42, 0xB8, 0x2A, 0x05, 0xAC, 0x32, 0xC1, 0x1B, 0x05, 0xBA, 0x41, 0xA1, 0x0C, 0x14, 0xBA,
+    0x48, 0x92, 0x8D, 0x33, 0xCA, 0x39, 0x94, 0x9C, 0x33, 0xD8, 0x29, 0x84, 0xAB, 0x42, 0xC0, 0x1A,
+    0x05, 0xAB, 0x41, 0xB1, 0x0B, 0x15, 0xCA, 0x40, 0xA1, 0x8B, 0x24, 0xD9, 0x38, 0x92, 0x8C, 0x42,
+    0xB9, 0x4A, 0x83, 0x9D, 0x32, 0xD0, 0x19, 0x84, 0xBA, 0x42, 0xB0, 0x1B, 0x06, 0xBA, 0x41, 0xA1,
+    0x0C, 0x23, 0xDA, 0x48, 0xA2, 0x9B, 0x34, 0xD9, 0x28, 0x93, 0x9C, 0x33, 0xD8, 0x3A, 0x84, 0xBB,
+    0x52, 0xB0, 0x2B, 0x05, 0xBB, 0x51, 0xA1, 0x0C, 0x14, 0xBA, 0x58, 0x91, 0x0C, 0x22, 0xC9, 0x38,
+    0xA3, 0x8D, 0x42, 0xB9, 0x3A, 0x85, 0xAB, 0x52, 0xB8, 0x2A, 0x04, 0xCB, 0x42, 0xB0, 0x1B, 0x15,
+    0xBB, 0x50, 0xA1, 0x8B, 0x25, 0xCA, 0x38, 0xA3, 0x9C, 0x24, 0xD8, 0x28, 0x93, 0x9C, 0x42, 0xB8,
+    0x2A, 0x05, 0xAC, 0x32, 0xC1, 0x1B, 0x05, 0xBA, 0x41, 0xB1, 0x0B, 0x25, 0xCB, 0x30, 0xA3, 0x8D,
+    0x33, 0xDA, 0x38, 0x93, 0x9D, 0x42, 0xC8, 0x29, 0x03, 0x9D, 0x41, 0xA8, 0x1A, 0x04, 0xBB, 0x52,
+    0xA0, 0x1C, 0x23, 0xDB, 0x30, 0xA2, 0x0D, 0x23, 0xCA, 0x38, 0xA4, 0x8C, 0x33, 0xD9, 0x39, 0x83,
+    0x9D, 0x32, 0xD0, 0x2A, 0x04, 0xBB, 0x42, 0xC1, 0x0A, 0x05, 0xBA, 0x41, 0xA1, 0x0C, 0x23, 0xDA,
+    0x30, 0xA2, 0x9C, 0x34, 0xCA, 0x28, 0x94, 0xAB, 0x34, 0xD8, 0x29, 0x03, 0x9D, 0x41, 0xB0, 0x2B,
+    0x04, 0xBB, 0x51, 0xB1, 0x0B, 0x25, 0xCB, 0x40, 0x91, 0x8C, 0x33, 0xCA, 0x49, 0x92, 0x8C, 0x42,
+    0xB9, 0x3A, 0x85, 0x9C, 0x32, 0xC0, 0x1A, 0x04, 0xBB, 0x52, 0xB1, 0x1C, 0x23, 0xDB, 0x40, 0xA1,
+    0x8B, 0x15, 0xC9, 0x38, 0xA3, 0x8C, 0x33, 0xE9, 0x28, 0x93, 0x9C, 0x42, 0xB8, 0x2A, 0x85, 0xAB,
+    0x42, 0xB0, 0x1C, 0x05, 0xBA, 0x41, 0xB1, 0x0B, 0x15, 0xBA, 0x58, 0xA2, 0x8C, 0x33, 0xCA, 0x49,
+    0x82, 0x8D, 0x32, 0xC9, 0x29, 0x84, 0xBB, 0x53, 0xC0, 0x2A, 0x13, 0xBC, 0x51, 0xA0, 0x1B, 0x14,
+    0xCA, 0x30, 0xB3, 0x8D, 0x24, 0xCA, 0x38, 0x93, 0x8D, 0x32, 0xC9, 0x39, 0x83, 0xAD, 0x43, 0xC8,
+    0x19, 0x04, 0xBB, 0x52, 0xB0, 0x1B, 0x15, 0xBB,
+};
+
+const audio_clip_t clip_round = { clip_round_data, 2000, 8000 };
+
+static const uint8_t clip_victory_data[2600] = {
+    0x70, 0x77, 0xFF, 0xFF, 0x67, 0xA0, 0xBD, 0x40, 0x34, 0xD9, 0x9C, 0x41, 0x14, 0xDA, 0x8A, 0x52,
+    0x82, 0xDA, 0x09, 0x33, 0x92, 0xBD, 0x29, 0x34, 0xB1, 0xAD, 0x38, 0x24, 0xB8, 0x9D, 0x30, 0x24,
+    0xCA, 0x8B, 0x42, 0x03, 0xDB, 0x0A, 0x52, 0x81, 0xCA, 0x09, 0x34, 0x90, 0xBC, 0x28, 0x34, 0xB0,
+    0xAD, 0x30, 0x24, 0xB9, 0x9D, 0x31, 0x14, 0xCA, 0x9A, 0x43, 0x83, 0xDB, 0x0A, 0x34, 0x81, 0xBC,
+    0x2A, 0x44, 0xA0, 0xBB, 0x49, 0x24, 0xB8, 0xAC, 0x40, 0x23, 0xC9, 0x8C, 0x31, 0x04, 0xCA, 0x8A,
+    0x43, 0x82, 0xDB, 0x09, 0x34, 0xA1, 0xBC, 0x28, 0x34, 0xB0, 0xAD, 0x30, 0x24, 0xC8, 0xAB, 0x41,
+    0x04, 0xB9, 0x8C, 0x42, 0x02, 0xCB, 0x0A, 0x53, 0x81, 0xDB, 0x19, 0x24, 0x90, 0xAC, 0x28, 0x24,
+    0xB0, 0xAC, 0x30, 0x15, 0xC8, 0x8B, 0x41, 0x03, 0xCA, 0x8B, 0x53, 0x82, 0xCB, 0x1A, 0x53, 0x91,
+    0xAC, 0x29, 0x24, 0xA0, 0xBC, 0x30, 0x25, 0xC8, 0x9B, 0x40, 0x23, 0xCA, 0x8C, 0x32, 0x03, 0xDB,
+    0x8A, 0x34, 0x82, 0xCC, 0x19, 0x43, 0xA1, 0xBC, 0x38, 0x34, 0xB8, 0xAD, 0x30, 0x15, 0xB8, 0x9C,
+    0x41, 0x12, 0xCA, 0x9A, 0x43, 0x83, 0xDB, 0x1A, 0x43, 0x91, 0xDB, 0x18, 0x43, 0xA0, 0xAC, 0x38,
+    0x24, 0xB8, 0x9D, 0x30, 0x14, 0xB9, 0x8D, 0x41, 0x02, 0xCA, 0x8A, 0x53, 0x81, 0xCA, 0x09, 0x24,
+    0x91, 0xBC, 0x28, 0x34, 0xB0, 0xAD, 0x30, 0x24, 0xB9, 0x9D, 0x31, 0x14, 0xCA, 0x9A, 0x43, 0x83,
+    0xDB, 0x0A, 0x34, 0x91, 0xDB, 0x29, 0x43, 0xA0, 0xAC, 0x28, 0x25, 0xB8, 0xBB, 0x41, 0x24, 0xC9,
+    0x9B, 0x42, 0x03, 0xDA, 0x8A, 0x43, 0x82, 0xDB, 0x09, 0x43, 0x91, 0xBC, 0x28, 0x34, 0xB0, 0xAD,
+    0x20, 0x15, 0xB8, 0xAB, 0x51, 0x13, 0xCA, 0x8B, 0x52, 0x02, 0xCB, 0x0A, 0x53, 0x81, 0xCB, 0x19,
+    0x43, 0xA1, 0xBC, 0x38, 0x34, 0xB8, 0xAD, 0x40, 0x23, 0xD9, 0x9A, 0x41, 0x03, 0xDA, 0x8A, 0x43,
+    0x82, 0xCB, 0x0A, 0x34, 0xA2, 0xBC, 0x29, 0x35, 0xB0, 0xBC, 0x30, 0x25, 0xC8, 0x9B, 0x31, 0x15,
+    0xBA, 0x9B, 0x62, 0x02, 0xCA, 0x8A, 0x53, 0x81, 0xCB, 0x19, 0x43, 0xA1, 0xCB, 0x28, 0x34, 0xB8,
+    0xBC, 0x40, 0x14, 0xC8, 0x9A, 0x41, 0x12, 0xCA, 0x8B, 0x53, 0x82, 0xCB, 0x1A, 0x43, 0x92, 0xCC,
+    0x18, 0x43, 0xA0, 0xAC, 0x38, 0x24, 0xB8, 0x9D, 0x30, 0x14, 0xB9, 0x9C, 0x42, 0x03, 0xCB, 0x0B,
+    0x53, 0x82, 0xBC, 0x09, 0x25, 0x91, 0xBC, 0x28, 0x34, 0xB0, 0xAD, 0x30, 0x24, 0xB9, 0x9D, 0x41,
+    0x12, 0xCA, 0x8A, 0x42, 0x83, 0xDB, 0x09, 0x43, 0x91, 0xCB, 0x19, 0x34, 0xA1, 0xBD, 0x20, 0x24,
+    0xB0, 0xAD, 0x31, 0x14, 0xC9, 0x8B, 0x51, 0x02, 0xCA, 0x8A, 0x43, 0x82, 0xCB, 0x1A, 0x34, 0x91,
+    0xBD, 0x28, 0x34, 0xB0, 0xAD, 0x30, 0x24, 0xB9, 0x9D, 0x31, 0x14, 0xCA, 0x9A, 0x43, 0x02, 0xCB,
+    0x0B, 0x44, 0x81, 0xAC, 0x19, 0x43, 0xA1, 0xBC, 0x28, 0x25, 0xB0, 0xAC, 0x40, 0x13, 0xD8, 0x9A,
+    0x41, 0x03, 0xCA, 0x8B, 0x53, 0x82, 0xCB, 0x1A, 0x53, 0x91, 0xAC, 0x29, 0x24, 0xA0, 0xBC, 0x30,
+    0x15, 0xB8, 0x9C, 0x31, 0x14, 0xC9, 0x9B, 0x43, 0x79, 0xF3, 0x8F, 0x73, 0xC1, 0x8C, 0x63, 0xB0,
+    0x9C, 0x44, 0xA0, 0x9D, 0x43, 0xB1, 0x9D, 0x43, 0xB2, 0x9D, 0x42, 0xA1, 0x9C, 0x42, 0xA1, 0x9C,
+    0x41, 0xA2, 0xBB, 0x52, 0x92, 0xAC, 0x41, 0x92, 0xAC, 0x41, 0x92, 0xAC, 0x31, 0x83, 0xAD, 0x30,
+    0x84, 0xAC, 0x30, 0x84, 0xAC, 0x48, 0x02, 0xCB, 0x48, 0x02, 0xCB, 0x38, 0x04, 0xBB, 0x49, 0x04,
+    0xBB, 0x49, 0x13, 0xDB, 0x39, 0x04, 0xCA, 0x18, 0x14, 0xBA, 0x3A, 0x15, 0xCA, 0x19, 0x15, 0xC9,
+    0x19, 0x23, 0xD9, 0x19, 0x23, 0xC9, 0x1B, 0x25, 0xB9, 0x1B, 0x25, 0xB9, 0x1C, 0x43, 0xB9, 0x0B,
+    0x25, 0xC0, 0x0B, 0x43, 0xC0, 0x0B, 0x43, 0xC0, 0x8A, 0x43, 0xB0, 0x8C, 0x33, 0xC1, 0x8C, 0x42,
+    0xB1, 0x8C, 0x42, 0xB1, 0xAB, 0x63, 0x90, 0x8C, 0x31, 0xA2, 0x9D, 0x32, 0xA2, 0x9D, 0x41, 0x91,
+    0x9C, 0x31, 0xA3, 0xAD, 0x41, 0x92, 0xBB, 0x51, 0x82, 0xAD, 0x31, 0x93, 0xBC, 0x50, 0x82, 0xBB,
+    0x58, 0x02, 0xAC, 0x48, 0x02, 0xCB, 0x38, 0x04, 0xCB, 0x38, 0x04, 0xBB, 0x49, 0x13, 0xDB, 0x39,
+    0x04, 0xCA, 0x39, 0x04, 0xBA, 0x3A, 0x15, 0xCA, 0x29, 0x14, 0xCA, 0x19, 0x15, 0xB9, 0x1A, 0x15,
+    0xB9, 0x2B, 0x15, 0xC8, 0x1A, 0x33, 0xD9, 0x1A, 0x43, 0xB9, 0x0C, 0x24, 0xB8, 0x0B, 0x44, 0xB8,
+    0x0C, 0x33, 0xC0, 0x0C, 0x33, 0xC0, 0x8C, 0x43, 0xB0, 0x9B, 0x34, 0xC1, 0x9B, 0x53, 0xB1, 0x8C,
+    0x42, 0xB1, 0xAB, 0x53, 0xA1, 0x9C, 0x42, 0xA1, 0x9C, 0x42, 0x91, 0xAC, 0x32, 0xA3, 0xAD, 0x41,
+    0x92, 0xAC, 0x41, 0x92, 0xAC, 0x41, 0x92, 0xBB, 0x50, 0x93, 0xCB, 0x40, 0x82, 0xCB, 0x40, 0x02,
+    0xAC, 0x38, 0x04, 0xAC, 0x38, 0x04, 0xCB, 0x38, 0x13, 0xCC, 0x28, 0x14, 0xCB, 0x28, 0x04, 0xBA,
+    0x29, 0x15, 0xCA, 0x29, 0x14, 0xCA, 0x29, 0x14, 0xC9, 0x2A, 0x14, 0xC9, 0x19, 0x23, 0xD9, 0x1A,
+    0x24, 0xB9, 0x1B, 0x25, 0xB9, 0x1C, 0x24, 0xC8, 0x0A, 0x43, 0xC8, 0x8A, 0x24, 0xC0, 0x8A, 0x24,
+    0xB0, 0x8C, 0x43, 0xB0, 0x8C, 0x43, 0xB0, 0x9B, 0x34, 0xB1, 0x9D, 0x43, 0xA0, 0x9C, 0x43, 0xA0,
+    0xAB, 0x53, 0xA1, 0x9C, 0x42, 0xA1, 0x9C, 0x32, 0xA3, 0x9E, 0x31, 0x92, 0xAD, 0x41, 0x92, 0x9C,
+    0x40, 0x92, 0xBB, 0x41, 0x93, 0xBC, 0x41, 0x83, 0xAD, 0x30, 0x83, 0xBC, 0x58, 0x83, 0xCB, 0x38,
+    0x04, 0xCB, 0x38, 0x04, 0xCB, 0x38, 0x04, 0xBB, 0x39, 0x06, 0xBA, 0x39, 0x14, 0xDA, 0x29, 0x14,
+    0xCA, 0x29, 0x14, 0xBA, 0x2A, 0x15, 0xC9, 0x19, 0x33, 0xDA, 0x1A, 0x24, 0xC9, 0x1A, 0x24, 0xB9,
+    0x1B, 0x34, 0xD8, 0x1B, 0x24, 0xC8, 0x0A, 0x43, 0xC8, 0x0A, 0x33, 0xD0, 0x0B, 0x43, 0xB0, 0x8C,
+    0x43, 0xB0, 0x8C, 0x43, 0xB0, 0x8C, 0x33, 0xB1, 0x8E, 0x32, 0xB1, 0x9C, 0x52, 0xA1, 0x9C, 0x42,
+    0xA1, 0x9C, 0x42, 0xA1, 0xAB, 0x52, 0x91, 0xAC, 0x32, 0xA3, 0xAD, 0x41, 0x82, 0x9D, 0x30, 0x93,
+    0xBC, 0x41, 0x93, 0xAC, 0x40, 0x82, 0xAC, 0x30, 0x84, 0xCB, 0x30, 0x84, 0xCB, 0x30, 0x03, 0xCC,
+    0x38, 0x04, 0xBB, 0x49, 0x04, 0xCA, 0x39, 0x04, 0xCA, 0x28, 0x13, 0xDA, 0x29, 0x14, 0xCA, 0x29,
+    0x71, 0xF0, 0x4D, 0x85, 0xBD, 0x44, 0xD0, 0x2A, 0x05, 0xBC, 0x62, 0xB0, 0x1B, 0x16, 0xCB, 0x41,
+    0xA1, 0x8C, 0x24, 0xCA, 0x48, 0x91, 0x8B, 0x43, 0xD9, 0x28, 0x93, 0x9C, 0x33, 0xD8, 0x29, 0x03,
+    0x9D, 0x41, 0xB0, 0x2B, 0x14, 0xAC, 0x40, 0xA1, 0x0C, 0x14, 0xBA, 0x40, 0x91, 0x8C, 0x33, 0xDA,
+    0x38, 0xA3, 0x9C, 0x43, 0xD8, 0x29, 0x83, 0x9C, 0x42, 0xB8, 0x2A, 0x04, 0xCB, 0x51, 0xA0, 0x1B,
+    0x14, 0xBB, 0x50, 0xA1, 0x8B, 0x25, 0xCA, 0x38, 0xA3, 0x9C, 0x24, 0xC9, 0x39, 0x84, 0x9C, 0x32,
+    0xC8, 0x2A, 0x85, 0xBA, 0x42, 0xB0, 0x2B, 0x05, 0xCA, 0x31, 0xC2, 0x0B, 0x15, 0xBA, 0x58, 0x91,
+    0x9B, 0x24, 0xC9, 0x38, 0x93, 0x9D, 0x33, 0xC9, 0x3A, 0x84, 0x9C, 0x51, 0xA8, 0x1A, 0x04, 0xBB,
+    0x42, 0xB1, 0x1C, 0x14, 0xBB, 0x50, 0xA1, 0x8B, 0x34, 0xDA, 0x38, 0xA3, 0x9C, 0x43, 0xC9, 0x39,
+    0x83, 0x9D, 0x42, 0xB8, 0x2A, 0x04, 0xAC, 0x51, 0xA0, 0x1B, 0x14, 0xBB, 0x50, 0xA1, 0x0C, 0x23,
+    0xCA, 0x48, 0xA2, 0x8C, 0x33, 0xD9, 0x39, 0x94, 0xAB, 0x53, 0xC8, 0x29, 0x83, 0xBB, 0x62, 0xB0,
+    0x2B, 0x14, 0xAC, 0x41, 0xA0, 0x0B, 0x15, 0xCA, 0x30, 0xA2, 0x8C, 0x24, 0xCA, 0x38, 0x93, 0x9D,
+    0x33, 0xD8, 0x29, 0x84, 0x9C, 0x32, 0xB8, 0x2B, 0x06, 0xAB, 0x41, 0xB1, 0x1C, 0x23, 0xBC, 0x50,
+    0xA1, 0x0B, 0x24, 0xDA, 0x38, 0xA3, 0x8C, 0x33, 0xD9, 0x39, 0x93, 0xAC, 0x43, 0xD0, 0x19, 0x84,
+    0xAA, 0x41, 0xB0, 0x2B, 0x05, 0xCA, 0x31, 0xB2, 0x0D, 0x14, 0xBA, 0x48, 0xA2, 0x8C, 0x24, 0xC9,
+    0x28, 0x93, 0x9C, 0x33, 0xD8, 0x3A, 0x84, 0x9C, 0x41, 0xB0, 0x2B, 0x05, 0xAB, 0x41, 0xB1, 0x0C,
+    0x14, 0xBA, 0x40, 0xA2, 0x0D, 0x23, 0xCA, 0x49, 0x92, 0x8C, 0x42, 0xB9, 0x29, 0x85, 0x9C, 0x32,
+    0xB8, 0x3B, 0x05, 0xAC, 0x41, 0xB1, 0x1B, 0x14, 0xCB, 0x41, 0xA1, 0x0C, 0x23, 0xDA, 0x48, 0x91,
+    0x8B, 0x43, 0xD9, 0x28, 0x93, 0x9C, 0x33, 0xD8, 0x29, 0x03, 0xAD, 0x42, 0xB0, 0x2B, 0x14, 0xAC,
+    0x40, 0xA1, 0x0C, 0x14, 0xBA, 0x40, 0xA2, 0x0D, 0x22, 0xC9, 0x38, 0xA3, 0x9C, 0x43, 0xD8, 0x29,
+    0x83, 0x9C, 0x42, 0xB8, 0x3B, 0x04, 0xCB, 0x51, 0xA0, 0x1B, 0x14, 0xBB, 0x50, 0xA1, 0x0C, 0x33,
+    0xDA, 0x38, 0xA3, 0x8D, 0x33, 0xCA, 0x39, 0x84, 0x9D, 0x32, 0xB8, 0x3B, 0x05, 0xAC, 0x32, 0xC1,
+    0x1B, 0x15, 0xBB, 0x41, 0xA1, 0x0C, 0x33, 0xDB, 0x48, 0xA2, 0x8C, 0x33, 0xD9, 0x28, 0x93, 0x9C,
+    0x33, 0xD8, 0x3A, 0x84, 0x9C, 0x41, 0xB0, 0x2B, 0x05, 0xBB, 0x42, 0xB1, 0x1C, 0x23, 0xDB, 0x40,
+    0xA1, 0x8B, 0x24, 0xD9, 0x38, 0xA3, 0x9C, 0x43, 0xC9, 0x28, 0x83, 0x9D, 0x32, 0xD0, 0x19, 0x04,
+    0xBB, 0x42, 0xC1, 0x1A, 0x04, 0xBA, 0x50, 0xA1, 0x0C, 0x23, 0xCA, 0x48, 0xA2, 0x8C, 0x33, 0xD9,
+    0x39, 0x93, 0x9C, 0x33, 0xD8, 0x3A, 0x84, 0xBB, 0x62, 0xB0, 0x1A, 0x04, 0xBB, 0x51, 0xA1, 0x0C,
+    0x14, 0xBA, 0x40, 0x91, 0x0D, 0x22, 0xC9, 0x38, 0xA3, 0x9C, 0x43, 0xD8, 0x29, 0x83, 0x9C, 0x42,
+    0xB8, 0x3B, 0x04, 0xCB, 0x51, 0xA0, 0x1B, 0x14, 0x5B, 0xFD, 0x35, 0x9F, 0x05, 0x0D, 0x84, 0x1D,
+    0x93, 0x2D, 0xB3, 0x4C, 0xC2, 0x5A, 0xC1, 0x38, 0xD0, 0x40, 0xC8, 0x31, 0xCA, 0x33, 0xAC, 0x33,
+    0x9D, 0x04, 0x8C, 0x04, 0x0C, 0x94, 0x2C, 0xB3, 0x4B, 0xB2, 0x5B, 0xC1, 0x38, 0xD1, 0x48, 0xC8,
+    0x41, 0xBA, 0x42, 0xBA, 0x33, 0x9D, 0x04, 0x9B, 0x05, 0x0C, 0x94, 0x1B, 0xA4, 0x3B, 0xC3, 0x4A,
+    0xC1, 0x49, 0xC1, 0x48, 0xC8, 0x31, 0xC9, 0x32, 0xBB, 0x24, 0x9C, 0x23, 0x9D, 0x04, 0x8B, 0x95,
+    0x1B, 0x94, 0x2B, 0xB3, 0x4C, 0xC2, 0x39, 0xC1, 0x48, 0xB8, 0x40, 0xB9, 0x51, 0xBA, 0x33, 0xAC,
+    0x14, 0x8C, 0x03, 0x8C, 0x85, 0x0B, 0x94, 0x2B, 0xB3, 0x3C, 0xC3, 0x4A, 0xC1, 0x48, 0xB8, 0x40,
+    0xC8, 0x31, 0xBA, 0x33, 0xBC, 0x15, 0x9B, 0x04, 0x8C, 0x04, 0x0C, 0x93, 0x2B, 0xA3, 0x3C, 0xD3,
+    0x39, 0xD2, 0x49, 0xB0, 0x48, 0xB8, 0x50, 0xB9, 0x32, 0xBB, 0x24, 0x9C, 0x23, 0x8E, 0x03, 0x0C,
+    0x83, 0x1C, 0xA3, 0x3B, 0xC4, 0x4A, 0xB1, 0x49, 0xC0, 0x48, 0xB8, 0x31, 0xC9, 0x32, 0xCB, 0x33,
+    0xAC, 0x14, 0x8C, 0x04, 0x0C, 0x93, 0x1B, 0x94, 0x2C, 0xB3, 0x4B, 0xC2, 0x49, 0xC0, 0x48, 0xB8,
+    0x40, 0xC8, 0x31, 0xBA, 0x33, 0xAC, 0x14, 0xAB, 0x05, 0x8B, 0x85, 0x0B, 0x94, 0x2B, 0xB3, 0x4C,
+    0xC2, 0x39, 0xC1, 0x48, 0xB8, 0x40, 0xC8, 0x31, 0xBA, 0x42, 0xBB, 0x15, 0x9B, 0x14, 0x8D, 0x84,
+    0x0B, 0x94, 0x1A, 0xA3, 0x3C, 0xB2, 0x5B, 0xC1, 0x38, 0xC0, 0x40, 0xC8, 0x40, 0xB9, 0x32, 0xBB,
+    0x24, 0x9C, 0x23, 0x8D, 0x03, 0x0D, 0x83, 0x1C, 0xA3, 0x3B, 0xC3, 0x4A, 0xD2, 0x38, 0xC0, 0x48,
+    0xB8, 0x40, 0xB9, 0x42, 0xBA, 0x33, 0x9D, 0x23, 0x9D, 0x04, 0x8B, 0x84, 0x0B, 0x95, 0x2B, 0xB3,
+    0x4B, 0xC2, 0x49, 0xC0, 0x48, 0xB8, 0x40, 0xC8, 0x31, 0xBA, 0x33, 0xAC, 0x14, 0xAB, 0x05, 0x8B,
+    0x85, 0x0B, 0x94, 0x2B, 0xB3, 0x4C, 0xC2, 0x39, 0xC1, 0x48, 0xB8, 0x40, 0xC8, 0x31, 0xBA, 0x42,
+    0xBB, 0x15, 0x9B, 0x14, 0x8D, 0x84, 0x0B, 0x94, 0x1A, 0xA3, 0x3C, 0xB2, 0x5B, 0xC1, 0x38, 0xD1,
+    0x48, 0xB8, 0x31, 0xBA, 0x42, 0xCA, 0x33, 0x9D, 0x13, 0x8C, 0x84, 0x0B, 0x84, 0x1C, 0xA3, 0x3B,
+    0xC3, 0x5B, 0xB1, 0x5A, 0xB0, 0x48, 0xC0, 0x30, 0xB9, 0x42, 0xBB, 0x24, 0xBB, 0x15, 0x8C, 0x03,
+    0x0C, 0x84, 0x1C, 0xA3, 0x2B, 0xB4, 0x4B, 0xC2, 0x49, 0xB0, 0x48, 0xC0, 0x30, 0xC9, 0x32, 0xCA,
+    0x32, 0xBB, 0x15, 0x8C, 0x13, 0x8D, 0x84, 0x0B, 0x94, 0x2B, 0xB3, 0x4B, 0xD3, 0x39, 0xC1, 0x48,
+    0xB8, 0x40, 0xC8, 0x31, 0xBA, 0x42, 0xBB, 0x15, 0x9B, 0x14, 0x8D, 0x84, 0x0B, 0x94, 0x2B, 0xA3,
+    0x3C, 0xB2, 0x5B, 0xC1, 0x38, 0xD1, 0x48, 0xB8, 0x31, 0xC9, 0x41, 0xBA, 0x33, 0xAC, 0x14, 0x8C,
+    0x03, 0x0C, 0x94, 0x1B, 0xA4, 0x3B, 0xC3, 0x4A, 0xC2, 0x39, 0xD1, 0x48, 0xB8, 0x31, 0xC9, 0x41,
+    0xBA, 0x33, 0xAC, 0x14, 0x8C, 0x84, 0x0B, 0x84, 0x1C, 0xA3, 0x2B, 0xB4, 0x3A, 0xD3, 0x49, 0xB0,
+    0x59, 0xC0, 0x30, 0xC8, 0x31, 0xBA, 0x33, 0xBC, 0x15, 0x9B, 0x04, 0x8C, 0x84, 0x1B, 0x94, 0x2C,
+    0xA2, 0x4B, 0xC2, 0x39, 0xC1, 0x48, 0xB8, 0x40, 0xC8, 0x31, 0xCA, 0x32, 0xBB, 0x15, 0xAB, 0x15,
+    0x8C, 0x03, 0x0C, 0x83, 0x1D, 0xA3, 0x3B, 0xC3, 0x4A, 0xC1, 0x48, 0xC0, 0x30, 0xC8, 0x40, 0xB9,
+    0x32, 0xBB, 0x24, 0x9C, 0x23, 0x8D, 0x03, 0x0D, 0x83, 0x1C, 0xA3, 0x3B, 0xC4, 0x4A, 0xB1, 0x49,
+    0xC0, 0x30, 0xC8, 0x40, 0xB9, 0x32, 0xCA, 0x33, 0x9D, 0x13, 0x9C, 0x05, 0x0C, 0x83, 0x1C, 0x92,
+    0x2B, 0xB4, 0x3A, 0xD3, 0x49, 0xB0, 0x59, 0xC0, 0x30, 0xB9, 0x32, 0xCA, 0x42, 0xBB, 0x15, 0x9B,
+    0x04, 0x0C, 0x83, 0x0C, 0x94, 0x2B, 0xB3, 0x4B, 0xD3, 0x39, 0xD2, 0x38, 0xC0, 0x48, 0xB8, 0x31,
+    0xCA, 0x33, 0xAC, 0x33, 0x9D, 0x04, 0x9B, 0x85, 0x0B, 0x84, 0x1C, 0xA3, 0x3B, 0xC3, 0x4A, 0xD2,
+    0x38, 0xC0, 0x48, 0xB8, 0x31, 0xC9, 0x32, 0xCB, 0x33, 0xAC, 0x14, 0x8C, 0x84, 0x0B, 0x94, 0x1B,
+    0x94, 0x2C, 0xB3, 0x4B, 0xC2, 0x49, 0xB0, 0x48, 0xC8, 0x31, 0xC9, 0x41, 0xAA, 0x32, 0xAC, 0x14,
+    0x8C, 0x03, 0x0C, 0x94, 0x1B, 0x94, 0x2C, 0xA2, 0x4B, 0xC2, 0x49, 0xB0, 0x48, 0xB8, 0x40, 0xC8,
+    0x31, 0xCA, 0x23, 0xBB, 0x15, 0x9B, 0x14, 0x8D, 0x84, 0x1B, 0x93, 0x1C, 0xA4, 0x3B, 0xC3, 0x4A,
+    0xC1, 0x38, 0xC0, 0x30, 0xD8, 0x31, 0xC9, 0x32, 0xBB, 0x24, 0x9C, 0x04, 0x8C, 0x84, 0x1B, 0x93,
+    0x1C, 0xA4, 0x3B, 0xC3, 0x4A, 0xB1, 0x49, 0xD1, 0x30, 0xC8, 0x40, 0xB9, 0x32, 0xBB, 0x24, 0xAC,
+    0x05, 0x8B, 0x04, 0x0C, 0x93, 0x1B, 0x94, 0x2C, 0xB3, 0x4B, 0xC2, 0x49, 0xB0, 0x48, 0xC8, 0x31,
+    0xC9, 0x41, 0xBA, 0x33, 0xAC, 0x14, 0x8C, 0x03, 0x0C, 0x84, 0x1C, 0x92, 0x2B, 0xB4, 0x3A, 0xD3,
+    0x49, 0xB0, 0x59, 0xC0, 0x30, 0xB9, 0x41, 0xC9, 0x32, 0xBB, 0x24, 0x9C, 0x04, 0x8B, 0x84, 0x1C,
+    0x93, 0x2C, 0xB3, 0x3B, 0xC4, 0x4A, 0xC1, 0x48, 0xB8, 0x40, 0xC8, 0x31, 0xBA, 0x33, 0xAC, 0x33,
+    0x9D, 0x04, 0x8C, 0x84, 0x1B, 0x93, 0x1C, 0xA4, 0x3B, 0xC3, 0x4A, 0xB1, 0x59, 0xC0, 0x30, 0xC8,
+    0x40, 0xB9, 0x32, 0xBB, 0x24, 0x9C, 0x23, 0x9D, 0x04, 0x0C, 0x83, 0x1C, 0xA3, 0x3B, 0xB4, 0x4B,
+    0xC2, 0x49, 0xC0, 0x30, 0xC8, 0x40, 0xB9, 0x32, 0xCA, 0x23, 0xAC, 0x24, 0x9C, 0x04, 0x0C, 0x83,
+    0x1C, 0xA3, 0x2B, 0xB4, 0x3A, 0xD3, 0x49, 0xB0, 0x59, 0xC0, 0x30, 0xB9, 0x51, 0xAA, 0x32, 0xAC,
+    0x14, 0x9B, 0x04, 0x8C, 0x84, 0x1B, 0x94, 0x2C, 0xA2, 0x3B, 0xC3, 0x4A, 0xD2, 0x38, 0xC0, 0x30,
+    0xD8, 0x31, 0xBA, 0x33, 0xAC, 0x14, 0xAB, 0x15, 0x8C, 0x03, 0x0D, 0x83, 0x1C, 0xA3, 0x3B, 0xC3,
+    0x4A, 0xD2, 0x38, 0xC0, 0x48, 0xB8, 0x40, 0xB9, 0x42, 0xAB, 0x33, 0x9D, 0x23, 0x8D, 0x03, 0x0D,
+    0x83, 0x1C, 0xA3, 0x3B, 0xC3, 0x5B, 0xB1, 0x49, 0xD1, 0x48, 0xB8, 0x40, 0xB9, 0x32, 0xCA, 0x23,
+    0xBB, 0x15, 0x8C, 0x13, 0x0D, 0x83, 0x0C, 0x94, 0x2B, 0xB3, 0x4B, 0xC2, 0x5A, 0xB0, 0x48, 0xC0,
+    0x30, 0xB9, 0x41, 0xC9, 0x32, 0xBB, 0x24, 0x9C, 0x04, 0x0C, 0x83, 0x0C, 0x94, 0x2B, 0xA3, 0x3C,
+    0xD3, 0x39, 0xC1, 0x59, 0xC0, 0x30, 0xB9, 0x41, 0xB9, 0x32, 0xCB, 0x24, 0x9C, 0x13, 0x8C, 0x84,
+    0x0B, 0x94, 0x1B, 0xA5, 0x2A, 0xC3, 0x4A, 0xB1, 0x49, 0xC0, 0x48, 0xB8, 0x41, 0xC9, 0x22, 0xBA,
+    0x33, 0xAC, 0x14, 0x8C, 0x04, 0x0C, 0x93, 0x1B, 0xA4, 0x3B, 0xB4, 0x4B, 0xC2, 0x49, 0xC0, 0x48,
+    0xB8, 0x31, 0xC9, 0x41, 0xBA, 0x33, 0xAC, 0x14, 0x8C, 0x04, 0x0C, 0x93, 0x1B, 0x94, 0x2C, 0xB3,
+    0x4B, 0xC2, 0x39, 0xC1, 0x59, 0xC0, 0x30, 0xB9, 0x41, 0xC9, 0x32, 0xBB, 0x24, 0x9C, 0x04, 0x8B,
+    0x84, 0x0B, 0x95, 0x2B, 0xB3, 0x3C, 0xC3, 0x4A, 0xC1, 0x48, 0xB8, 0x40, 0xC8, 0x31, 0xBA, 0x42,
+    0xAB, 0x24, 0xAC, 0x14, 0x8C, 0x84, 0x0B, 0x94, 0x2B, 0xA3, 0x3C, 0xB2, 0x5B, 0xC1, 0x38, 0xD1,
+    0x48, 0xB8, 0x40, 0xB9, 0x32, 0xBB, 0x34, 0x9D, 0x13, 0x8C, 0x04, 0x0C, 0x93, 0x1C, 0xA4, 0x2A,
+    0xB3, 0x4B, 0xC2, 0x49, 0xC0, 0x48, 0xB8, 0x31, 0xC9, 0x41, 0xBA, 0x33, 0xAC, 0x14, 0x8C, 0x04,
+    0x0C, 0x83, 0x0C, 0x94, 0x2B, 0xB3, 0x4B, 0xC2, 0x49, 0xB0, 0x59, 0xC0, 0x30, 0xB9, 0x41, 0xC9,
+    0x32, 0xBB, 0x24, 0x9C, 0x04, 0x8B, 0x84, 0x1C, 0x93, 0x2C, 0xB3, 0x3B, 0xC4, 0x4A, 0xB1, 0x59,
+    0xC0, 0x30, 0xB9, 0x41, 0xC9, 0x32, 0xBB, 0x24, 0x9C, 0x04, 0x9B, 0x85, 0x0B, 0x84, 0x1C, 0xA3,
+    0x3B, 0xC3, 0x4A, 0xD2, 0x38, 0xC0, 0x48, 0xB8, 0x31, 0xD9, 0x22, 0xBA, 0x24, 0x9C, 0x23, 0x8D,
+    0x03, 0x0C, 0x83, 0x1D, 0xA3, 0x3B, 0xC3, 0x4A, 0xD2, 0x49, 0xB0, 0x48, 0xB8, 0x40, 0xB9, 0x42,
+    0xBA, 0x33, 0x9D, 0x13, 0x9C, 0x05, 0x0C, 0x83, 0x1C, 0x92, 0x2B, 0xB4, 0x3A, 0xD3, 0x49, 0xB0,
+    0x59, 0xC0, 0x30, 0xC8, 0x31, 0xBA, 0x33, 0xBC, 0x15, 0x9B, 0x04, 0x8C, 0x84, 0x1B, 0x93, 0x2C,
+    0xB3, 0x3C, 0xC3, 0x4A, 0xC1, 0x48, 0xC0, 0x30, 0xB9, 0x41, 0xC9, 0x32, 0xBB, 0x24, 0x9C, 0x04,
+    0x8C, 0x84, 0x1B, 0x93, 0x1C, 0xA4, 0x3B, 0xC3, 0x4A, 0xB1, 0x49, 0xD1, 0x48, 0xB8, 0x31, 0xC9,
+    0x41, 0xBA, 0x33, 0xAC, 0x14, 0x8C, 0x03, 0x0C, 0x83, 0x1D, 0xA3, 0x3B, 0xB4, 0x4B, 0xC2, 0x49,
+    0xC0, 0x30, 0xC8, 0x40, 0xB9, 0x32, 0xCA, 0x23, 0xAC, 0x24, 0x9C, 0x04, 0x8B, 0x84, 0x1C, 0x93,
+    0x2C, 0xA2, 0x4B, 0xC2, 0x39, 0xC1, 0x59, 0xB8, 0x40, 0xC8, 0x31, 0xBA, 0x33, 0xAC, 0x14, 0xAB,
+    0x15, 0x8C, 0x03, 0x0C, 0x93, 0x2C, 0xB3, 0x4B, 0xC3, 0x4A, 0xC1, 0x38, 0xC0, 0x48, 0xB8, 0x41,
+    0xBA, 0x42, 0xAB, 0x14, 0xAB, 0x15, 0x8C, 0x03, 0x0C, 0x83, 0x1D, 0xA3, 0x3B, 0xC3, 0x4A, 0xC1,
+    0x49, 0xC1, 0x48, 0xB8, 0x40, 0xB9, 0x32, 0xBB, 0x24, 0x9C, 0x14, 0x8C, 0x03, 0x0D, 0x83, 0x1C,
+    0xA3, 0x2B, 0xB4, 0x5B, 0xB1, 0x49, 0xD1, 0x48, 0xB8, 0x31, 0xC9, 0x31, 0xBA, 0x43, 0xAC, 0x14,
+    0x9B, 0x04, 0x0C, 0x83, 0x1C, 0x93, 0x2D, 0xB3,
+};
+
+const audio_clip_t clip_victory = { clip_victory_data, 5200, 8000 };
@@ -0,0 +1,13 @@
+#include "pico/stdlib.h"
+#include "audio.h"
+
+#ifndef clips_inc_h
+#define clips_inc_h
+
+// Gerado por host/adpcm_encode.c; não edite. Para refazer:
+//   adpcm_encode inc/clips clip_round=tom:1047/90,1568/160 clip_victory=tom:1047/110,1319/110,1568/110,2093/320
+
+extern const audio_clip_t clip_round; // 250 ms a 8000 Hz
+extern const audio_clip_t clip_victory; // 650 ms a 8000 Hz
+
+#endif
@@ -0,0 +1,98 @@
+#include "pico/stdlib.h"
+
+#ifndef hal_inc_h
+#define hal_inc_h
+
+// Camada de abstração do hardware: os módulos do jogo e do display só falam com estas funções.
+// hal_pico.c implementa sobre o pico-sdk; hal_host.c simula a placa no PC (relógio virtual,
+// botões e joystick roteirizados, barramento I2C que conta bytes e emula o painel)
+
+#define hal_edge_fall 0x4u   // Borda de descida (mesmo valor de GPIO_IRQ_EDGE_FALL)
+#define hal_edge_rise 0x8u   // Borda de subida (mesmo valor de GPIO_IRQ_EDGE_RISE)
+#define hal_i2c_stop 0x200u  // Palavra de hal_i2c_write_async() que encerra a transação (STOP)
+#define hal_pwm_wrap 4095u   // Wrap comum a todos os slices: níveis de 0 a 4096 (12 bits)
+#define hal_pwm_max_frames 512u // Quadros de uma animação de níveis por hal_pwm_play()
+#define hal_pcm_block 256u       // Amostras em cada metade do buffer de áudio (32 ms a 8 kHz)
+
+#define hal_flash_page_size 256u      // Menor unidade de gravação da flash
+#define hal_flash_sector_size 4096u   // Menor unidade de apagamento
+#define hal_flash_data_size (16 * hal_flash_sector_size) // Área de dados reservada no fim da flash
+
+// Chamada na interrupção de borda de um pino (events = hal_edge_fall e/ou hal_edge_rise)
+typedef void (*hal_edge_callback_t)(uint pin, uint32_t events);
+
+// Alarme: retorno < 0 reagenda a partir do prazo anterior, > 0 a partir de agora, 0 encerra
+typedef int64_t (*hal_alarm_callback_t)(void);
+
+// Preenche até count níveis de PWM (0 a hal_pwm_wrap + 1) com as próximas amostras e retorna
+// quantos escreveu; menos que count encerra o som. Chamada em contexto de interrupção
+typedef uint (*hal_pcm_refill_t)(uint16_t *levels, uint count);
+
+// Fim do som (em contexto de interrupção)
+typedef void (*hal_pcm_done_t)(void);
+
+// Fim de uma escrita assíncrona (em contexto de interrupção); ok = false se o dispositivo não respondeu
+typedef void (*hal_i2c_done_t)(bool ok);
+
+extern void hal_init();
+
+// Tempo e eventos
+extern uint64_t hal_time_us();
+extern void hal_wait_until(uint64_t deadline_us);
+extern void hal_wake();
+extern void hal_barrier();
+extern uint32_t hal_irq_disable();
+extern void hal_irq_restore(uint32_t state);
+extern uint32_t hal_clock_hz();
+extern bool hal_dormant_until_edge(uint pin);
+
+// GPIO
+extern void hal_gpio_output(uint pin);
+extern void hal_gpio_put(uint pin, bool value);
+extern void hal_gpio_input_pullup(uint pin);
+extern bool hal_gpio_get(uint pin);
+extern void hal_gpio_edge_irq(uint pin, hal_edge_callback_t callback);
+
+// PWM (buzzer e LED RGB), amostras no buzzer e alarmes. O wrap é fixo; a frequência de cada slice
+// muda só pelo divisor
+extern void hal_pwm_init(uint pin);
+extern void hal_pwm_set(uint pin, uint8_t div_int, uint8_t div_frac, uint16_t level);
+extern void hal_pwm_level(uint pin, uint16_t level);
+extern void hal_pwm_enable(uint pin, bool enabled);
+extern void hal_pwm_play(const uint *pins, uint count, const uint16_t *levels, uint frames, uint32_t frame_us);
+extern bool hal_pwm_play_busy();
+extern void hal_pwm_play_stop();
+extern void hal_pcm_init(uint pin);
+extern void hal_pcm_start(uint sample_rate, hal_pcm_refill_t refill, hal_pcm_done_t done);
+extern bool hal_pcm_busy();
+extern void hal_pcm_stop();
+extern void hal_alarm_init();
+extern int hal_alarm_start(uint64_t delay_us, hal_alarm_callback_t callback);
+extern void hal_alarm_cancel(int alarm);
+
+// ADC em round-robin de dois canais gravando continuamente num anel (pares X/Y intercalados)
+extern void hal_adc_stream_init(uint x_pin, uint y_pin, uint16_t *ring, uint ring_length, uint sample_rate);
+extern uint hal_adc_stream_position();
+extern void hal_adc_stream_enable(bool enabled);
+
+// Barramento I2C
+extern void hal_i2c_init(uint bus, uint sda, uint scl, uint baudrate);
+extern int hal_i2c_write(uint bus, uint8_t address, const uint8_t *head, size_t head_length,
+                         const uint8_t *data, size_t data_length);
+extern void hal_i2c_async_init(uint bus);
+extern void hal_i2c_write_async(uint bus, uint8_t address, const uint16_t *stream, uint words, hal_i2c_done_t done);
+
+// Área de dados na flash (offsets relativos ao início da área). A leitura é direta pelo ponteiro;
+// apagar e gravar param a execução a partir da flash enquanto duram (dezenas de ms por setor)
+extern const uint8_t *hal_flash_data();
+extern void hal_flash_erase(uint32_t offset, uint32_t length);
+extern void hal_flash_program(uint32_t offset, const uint8_t *data, uint32_t length);
+extern void hal_flash_lockout_init();
+
+// Porta serial USB (CDC) sem bloqueio: espaço livre agora no buffer de envio (0 sem host conectado)
+// e escrita de até esse tanto, que nunca espera pelo host
+extern bool hal_usb_connected();
+extern uint hal_usb_write_available();
+extern uint hal_usb_write(const uint8_t *data, uint length);
+
+#endif
@@ -0,0 +1,1108 @@
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "ssd1306_i2c.h"
+#include "hal.h"
+#include "hal_host.h"
+
+// Simulador da placa para o PC. O relógio é virtual: só avança quando o programa dorme em
+// hal_wait_until(), saltando direto para o próximo prazo, alarme ou evento do roteiro. Assim uma
+// partida inteira roda em milissegundos e sempre da mesma forma
+
+static uint64_t hal_host_now = 0;
+static bool hal_host_event = false; // Registrador de evento do WFE (hal_wake)
+static bool hal_host_trace = false; // GENIUS_TRACE: registra LEDs e notas no stdout
+
+static void hal_host_power_update();
+static void hal_host_display_switched(bool on);
+
+static void hal_host_log(const char *format, ...) {
+    va_list args;
+
+    printf("[%4llu.%03llu s] ", (unsigned long long) (hal_host_now / 1000000), (unsigned long long) ((hal_host_now / 1000) % 1000));
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+    putchar('\n');
+}
+
+// ----------------------------------------------------------------------------------------------
+// Painel SSD1306 emulado: interpreta o protocolo (bytes de controle, comandos e janela de escrita)
+// para que o quadro mostrado seja o que realmente passou pelo barramento
+
+typedef struct {
+    bool used;
+    uint8_t address;
+    uint8_t ram[ssd1306_buffer_length];
+    uint8_t column_start, column_end, page_start, page_end;
+    uint8_t column, page;
+    bool display_on;
+    bool inverted;
+    uint8_t contrast;
+    uint8_t start_line;
+    uint8_t scroll_setup[6];   // Último comando de rolagem (0x26, 0x27, 0x29 ou 0x2A) e argumentos
+    uint8_t scroll_top, scroll_rows; // Área de rolagem vertical (0xA3)
+    bool scrolling;
+    uint64_t scroll_start_us;  // Instante da ativação (0x2F): o deslocamento sai do relógio virtual
+    uint8_t command[8];   // Comando em recepção e seus argumentos
+    uint command_length;
+    uint command_needed;
+} hal_host_panel_t;
+
+typedef struct {
+    uint baudrate;
+    hal_host_i2c_stats_t stats;
+    hal_host_panel_t panels[hal_host_max_panels];
+} hal_host_bus_t;
+
+static hal_host_bus_t hal_host_buses[2];
+
+static hal_host_panel_t *hal_host_find_panel(uint bus, uint8_t address, bool create) {
+    hal_host_panel_t *panels = hal_host_buses[bus].panels;
+
+    for (int i = 0; i < hal_host_max_panels; i++) {
+        if (panels[i].used && panels[i].address == address) {
+            return &panels[i];
+        }
+    }
+    if (!create) {
+        return NULL;
+    }
+    for (int i = 0; i < hal_host_max_panels; i++) {
+        if (!panels[i].used) {
+            memset(&panels[i], 0, sizeof(panels[i]));
+            panels[i].used = true;
+            panels[i].address = address;
+            panels[i].column_end = ssd1306_width - 1;
+            panels[i].page_end = ssd1306_n_pages - 1;
+            panels[i].contrast = 0x7F;
+            panels[i].scroll_rows = ssd1306_height;
+            return &panels[i];
+        }
+    }
+    return NULL;
+}
+
+// Quantos argumentos seguem cada comando do SSD1306
+static uint hal_host_command_arguments(uint8_t command) {
+    switch (command) {
+        case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3:
+        case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+            return 1;
+        case 0x21: case 0x22: case 0xA3:
+            return 2;
+        case 0x29: case 0x2A:
+            return 5;
+        case 0x26: case 0x27:
+            return 6;
+        default:
+            return 0;
+    }
+}
+
+// Quadros entre dois passos de rolagem, pelo código de intervalo dos comandos 0x26-0x2A
+static const uint hal_host_scroll_frames[8] = { 5, 64, 128, 256, 3, 4, 25, 2 };
+
+// Passos dados desde a ativação da rolagem (0 com a rolagem parada)
+static uint hal_host_scroll_steps(const hal_host_panel_t *panel) {
+    if (!panel->scrolling) {
+        return 0;
+    }
+    uint frames = (hal_host_now - panel->scroll_start_us) / hal_host_panel_frame_us;
+    return frames / hal_host_scroll_frames[panel->scroll_setup[3] & 7];
+}
+
+// Deslocamento horizontal atual (colunas para a direita) das páginas que estão rolando
+static int hal_host_scroll_columns(const hal_host_panel_t *panel) {
+    bool left = panel->scroll_setup[0] == 0x27 || panel->scroll_setup[0] == 0x2A;
+    int steps = hal_host_scroll_steps(panel) % ssd1306_width;
+    return left ? -steps : steps;
+}
+
+// Deslocamento vertical atual (linhas para cima) da área de rolagem vertical
+static int hal_host_scroll_lines(const hal_host_panel_t *panel) {
+    bool diagonal = panel->scroll_setup[0] == 0x29 || panel->scroll_setup[0] == 0x2A;
+    if (!diagonal || panel->scroll_rows == 0) {
+        return 0;
+    }
+    return (hal_host_scroll_steps(panel) * (panel->scroll_setup[5] & 0x3F)) % panel->scroll_rows;
+}
+
+// Como no controlador real, parar a rolagem deixa a RAM deslocada: grava o deslocamento horizontal
+static void hal_host_scroll_stop(hal_host_panel_t *panel) {
+    int columns = hal_host_scroll_columns(panel);
+    uint8_t row[ssd1306_width];
+
+    panel->scrolling = false;
+    if (columns == 0) {
+        return;
+    }
+    for (int page = panel->scroll_setup[2] & 7; page <= (panel->scroll_setup[4] & 7); page++) {
+        uint8_t *ram = &panel->ram[page * ssd1306_width];
+        for (int x = 0; x < ssd1306_width; x++) {
+            row[(x + columns + ssd1306_width) % ssd1306_width] = ram[x];
+        }
+        memcpy(ram, row, ssd1306_width);
+    }
+}
+
+static void hal_host_panel_execute(hal_host_panel_t *panel) {
+    const uint8_t *command = panel->command;
+
+    switch (command[0]) {
+        case 0x21:
+            panel->column_start = panel->column = command[1] & 0x7F;
+            panel->column_end = command[2] & 0x7F;
+            break;
+        case 0x22:
+            panel->page_start = panel->page = command[1] & 0x07;
+            panel->page_end = command[2] & 0x07;
+            break;
+        case 0x81:
+            panel->contrast = command[1];
+            if (hal_host_trace) {
+                hal_host_log("display 0x%02X: contraste %u", panel->address, command[1]);
+            }
+            break;
+        case 0x26:
+        case 0x27:
+        case 0x29:
+        case 0x2A:
+            memcpy(panel->scroll_setup, command, sizeof(panel->scroll_setup));
+            break;
+        case 0xA3:
+            panel->scroll_top = command[1] & 0x3F;
+            panel->scroll_rows = command[2] & 0x7F;
+            break;
+        case 0x2E:
+            if (panel->scrolling) {
+                hal_host_scroll_stop(panel);
+                if (hal_host_trace) {
+                    hal_host_log("display 0x%02X: rolagem parada", panel->address);
+                }
+            }
+            break;
+        case 0x2F:
+            panel->scrolling = true;
+            panel->scroll_start_us = hal_host_now;
+            if (hal_host_trace) {
+                hal_host_log("display 0x%02X: rolagem 0x%02X, páginas %u-%u", panel->address,
+                             panel->scroll_setup[0], panel->scroll_setup[2], panel->scroll_setup[4]);
+            }
+            break;
+        case 0xA6:
+        case 0xA7:
+            if (hal_host_trace && panel->inverted != (command[0] & 1)) {
+                hal_host_log("display 0x%02X: %s", panel->address, (command[0] & 1) ? "inverso" : "normal");
+            }
+            panel->inverted = command[0] & 1;
+            break;
+        case 0xAE:
+        case 0xAF:
+            if (panel->display_on != (command[0] & 1)) {
+                hal_host_power_update();
+                panel->display_on = command[0] & 1;
+                hal_host_display_switched(panel->display_on);
+            }
+            break;
+        default:
+            if (command[0] >= 0x40 && command[0] <= 0x7F) {
+                panel->start_line = command[0] & 0x3F;
+            }
+            break;
+    }
+}
+
+static void hal_host_panel_command(hal_host_panel_t *panel, hal_host_i2c_stats_t *stats, uint8_t byte) {
+    stats->commands++;
+    if (panel->command_needed == 0) {
+        panel->command[0] = byte;
+        panel->command_length = 1;
+        panel->command_needed = hal_host_command_arguments(byte);
+    } else {
+        panel->command[panel->command_length++] = byte;
+        panel->command_needed--;
+    }
+    if (panel->command_needed == 0) {
+        hal_host_panel_execute(panel);
+    }
+}
+
+// Endereçamento horizontal: percorre a janela coluna a coluna, página a página, voltando ao início
+static void hal_host_panel_data(hal_host_panel_t *panel, hal_host_i2c_stats_t *stats, uint8_t byte) {
+    stats->pixels++;
+    panel->ram[panel->page * ssd1306_width + panel->column] = byte;
+    if (panel->column++ >= panel->column_end) {
+        panel->column = panel->column_start;
+        if (panel->page++ >= panel->page_end) {
+            panel->page = panel->page_start;
+        }
+    }
+}
+
+// Recebe uma transação completa: cada byte de controle diz se o que segue é comando ou dado e,
+// com Co = 1, que apenas o próximo byte é coberto por ele
+static void hal_host_i2c_receive(uint bus, uint8_t address, const uint8_t *bytes, size_t length) {
+    hal_host_bus_t *host_bus = &hal_host_buses[bus];
+    hal_host_panel_t *panel = hal_host_find_panel(bus, address, true);
+    size_t i = 0;
+
+    host_bus->stats.transactions++;
+    host_bus->stats.bytes += length;
+    if (host_bus->baudrate) {
+        host_bus->stats.bus_us += (uint64_t) (9 * (length + 1) + 2) * 1000000 / host_bus->baudrate;
+    }
+    if (!panel) {
+        return;
+    }
+
+    while (i < length) {
+        uint8_t control = bytes[i++];
+        bool data = control & 0x40;
+
+        if (control & 0x80) {
+            if (i < length) {
+                if (data) {
+                    hal_host_panel_data(panel, &host_bus->stats, bytes[i++]);
+                } else {
+                    hal_host_panel_command(panel, &host_bus->stats, bytes[i++]);
+                }
+            }
+            continue;
+        }
+
+        while (i < length) {
+            if (data) {
+                hal_host_panel_data(panel, &host_bus->stats, bytes[i++]);
+            } else {
+                hal_host_panel_command(panel, &host_bus->stats, bytes[i++]);
+            }
+        }
+    }
+}
+
+void hal_host_i2c_stats(uint bus, hal_host_i2c_stats_t *stats) {
+    *stats = hal_host_buses[bus].stats;
+}
+
+void hal_host_i2c_reset_stats(uint bus) {
+    memset(&hal_host_buses[bus].stats, 0, sizeof(hal_host_i2c_stats_t));
+}
+
+// GDDRAM do painel (ssd1306_buffer_length bytes, página por página) ou NULL se nada foi enviado a ele
+const uint8_t *hal_host_panel(uint bus, uint8_t address) {
+    hal_host_panel_t *panel = hal_host_find_panel(bus, address, false);
+    return panel ? panel->ram : NULL;
+}
+
+// Pixel como aparece no vidro: apagado com o display desligado, complementado no modo inverso,
+// deslocado pela linha inicial e pela rolagem em andamento
+static bool hal_host_panel_pixel(const hal_host_panel_t *panel, int x, int y) {
+    if (!panel->display_on) {
+        return false;
+    }
+
+    if (y >= panel->scroll_top && y < panel->scroll_top + panel->scroll_rows) {
+        y = panel->scroll_top + (y - panel->scroll_top + hal_host_scroll_lines(panel)) % panel->scroll_rows;
+    }
+    y = (y + panel->start_line) % ssd1306_height;
+
+    int page = y / 8;
+    if (panel->scrolling && page >= (panel->scroll_setup[2] & 7) && page <= (panel->scroll_setup[4] & 7)) {
+        x = (x - hal_host_scroll_columns(panel) + ssd1306_width) % ssd1306_width;
+    }
+
+    bool set = panel->ram[page * ssd1306_width + x] & (1 << (y % 8));
+    return set != panel->inverted;
+}
+
+// Grava o painel como PBM binário (pixels acesos em preto)
+bool hal_host_panel_dump_pbm(uint bus, uint8_t address, const char *path) {
+    hal_host_panel_t *panel = hal_host_find_panel(bus, address, false);
+    FILE *file = fopen(path, "wb");
+
+    if (!panel || !file) {
+        if (file) {
+            fclose(file);
+        }
+        return false;
+    }
+
+    fprintf(file, "P4\n%d %d\n", ssd1306_width, ssd1306_height);
+    for (int y = 0; y < ssd1306_height; y++) {
+        for (int x = 0; x < ssd1306_width; x += 8) {
+            uint8_t bits = 0;
+            for (int bit = 0; bit < 8; bit++) {
+                bits |= hal_host_panel_pixel(panel, x + bit, y) << (7 - bit);
+            }
+            fputc(bits, file);
+        }
+    }
+    fclose(file);
+    return true;
+}
+
+// Desenha o painel em texto: '#' aceso, '.' apagado
+void hal_host_panel_dump_ascii(uint bus, uint8_t address, FILE *out) {
+    hal_host_panel_t *panel = hal_host_find_panel(bus, address, false);
+
+    if (!panel) {
+        fprintf(out, "(nenhum dado enviado ao display 0x%02X)\n", address);
+        return;
+    }
+    for (int y = 0; y < ssd1306_height; y++) {
+        for (int x = 0; x < ssd1306_width; x++) {
+            fputc(hal_host_panel_pixel(panel, x, y) ? '#' : '.', out);
+        }
+        fputc('\n', out);
+    }
+}
+
+// ----------------------------------------------------------------------------------------------
+// GPIO, PWM e ADC simulados
+
+static bool hal_host_levels[hal_host_max_pins];
+static hal_edge_callback_t hal_host_edge_callbacks[hal_host_max_pins];
+
+static uint16_t *hal_host_adc_ring = NULL;
+static uint hal_host_adc_length = 0;
+static uint16_t hal_host_joystick_x = 2048;
+static uint16_t hal_host_joystick_y = 2048;
+
+// Pressiona ou solta um botão (pull-up: pressionado = nível baixo), gerando a interrupção de borda
+void hal_host_set_button(uint pin, bool pressed) {
+    bool level = !pressed;
+
+    if (pin >= hal_host_max_pins || hal_host_levels[pin] == level) {
+        return;
+    }
+    hal_host_levels[pin] = level;
+    if (hal_host_edge_callbacks[pin]) {
+        hal_host_edge_callbacks[pin](pin, level ? hal_edge_rise : hal_edge_fall);
+    }
+}
+
+// Posiciona o joystick (leituras de 12 bits, 2048 = centro)
+void hal_host_set_joystick(uint16_t x, uint16_t y) {
+    hal_host_joystick_x = x;
+    hal_host_joystick_y = y;
+}
+
+void hal_gpio_output(uint pin) {
+    hal_host_levels[pin] = false;
+}
+
+void hal_gpio_put(uint pin, bool value) {
+    if (hal_host_trace && hal_host_levels[pin] != value) {
+        hal_host_log("gpio %u = %d", pin, value);
+    }
+    hal_host_levels[pin] = value;
+}
+
+void hal_gpio_input_pullup(uint pin) {
+    hal_host_levels[pin] = true;
+}
+
+bool hal_gpio_get(uint pin) {
+    return hal_host_levels[pin];
+}
+
+void hal_gpio_edge_irq(uint pin, hal_edge_callback_t callback) {
+    hal_host_edge_callbacks[pin] = callback;
+}
+
+static uint16_t hal_host_pwm_levels[hal_host_max_pins];
+static uint64_t hal_host_pwm_play_end_us = 0; // Instante do último quadro da animação em andamento
+
+void hal_pwm_init(uint pin) {
+    hal_host_pwm_levels[pin] = 0;
+}
+
+void hal_pwm_set(uint pin, uint8_t div_int, uint8_t div_frac, uint16_t level) {
+    if (hal_host_trace) {
+        if (level) {
+            uint32_t frequency = (uint64_t) hal_host_clock_hz * 16 / ((div_int * 16 + div_frac) * (hal_pwm_wrap + 1));
+            hal_host_log("pwm %u = %lu Hz (%u/%u)", pin, (unsigned long) frequency, level, hal_pwm_wrap + 1);
+        } else {
+            hal_host_log("pwm %u = silêncio", pin);
+        }
+    }
+    hal_host_pwm_levels[pin] = level;
+}
+
+void hal_pwm_level(uint pin, uint16_t level) {
+    if (hal_host_trace && hal_host_pwm_levels[pin] != level) {
+        hal_host_log("pwm %u = %u/%u", pin, level, hal_pwm_wrap + 1);
+    }
+    hal_host_pwm_levels[pin] = level;
+}
+
+void hal_pwm_enable(uint pin, bool enabled) {
+    if (hal_host_trace) {
+        hal_host_log("pwm %u %s", pin, enabled ? "ligado" : "parado");
+    }
+}
+
+// Sem DMA no PC: os pinos vão direto para o último quadro e a animação só ocupa o tempo virtual
+void hal_pwm_play(const uint *pins, uint count, const uint16_t *levels, uint frames, uint32_t frame_us) {
+    if (frames == 0) {
+        return;
+    }
+    if (frames > hal_pwm_max_frames) {
+        frames = hal_pwm_max_frames;
+    }
+
+    if (hal_host_trace) {
+        hal_host_log("pwm: animação de %u quadros (%lu ms)", frames, (unsigned long) (frames * frame_us / 1000));
+    }
+    for (uint i = 0; i < count; i++) {
+        hal_host_pwm_levels[pins[i]] = levels[(frames - 1) * count + i];
+    }
+    hal_host_pwm_play_end_us = hal_host_now + (uint64_t) (frames - 1) * frame_us;
+}
+
+bool hal_pwm_play_busy() {
+    return hal_host_now < hal_host_pwm_play_end_us;
+}
+
+void hal_pwm_play_stop() {
+    hal_host_pwm_play_end_us = 0;
+}
+
+// Amostras no buzzer: sem DMA, tudo o que refill entrega é pedido de uma vez (e gravado no WAV de
+// GENIUS_WAV, para ouvir o que o PWM tocaria); o fim chega por um alarme no relógio virtual
+
+static FILE *hal_host_wav_file = NULL;
+static uint32_t hal_host_wav_rate = 0; // Taxa do WAV: a do primeiro som tocado
+static uint32_t hal_host_wav_samples = 0;
+static bool hal_host_pcm_playing = false;
+static hal_pcm_done_t hal_host_pcm_done = NULL;
+static int hal_host_pcm_alarm = 0;
+
+static void hal_host_wav_put(uint32_t value, uint bytes) {
+    for (uint i = 0; i < bytes; i++) {
+        fputc((value >> (8 * i)) & 0xFF, hal_host_wav_file);
+    }
+}
+
+// Cabeçalho RIFF de PCM de 16 bits mono; regravado ao fim de cada som para o arquivo valer sempre
+static void hal_host_wav_header() {
+    uint32_t data_bytes = hal_host_wav_samples * 2;
+
+    fseek(hal_host_wav_file, 0, SEEK_SET);
+    fwrite("RIFF", 1, 4, hal_host_wav_file);
+    hal_host_wav_put(36 + data_bytes, 4);
+    fwrite("WAVEfmt ", 1, 8, hal_host_wav_file);
+    hal_host_wav_put(16, 4);
+    hal_host_wav_put(1, 2); // PCM
+    hal_host_wav_put(1, 2); // Mono
+    hal_host_wav_put(hal_host_wav_rate, 4);
+    hal_host_wav_put(hal_host_wav_rate * 2, 4);
+    hal_host_wav_put(2, 2);
+    hal_host_wav_put(16, 2);
+    fwrite("data", 1, 4, hal_host_wav_file);
+    hal_host_wav_put(data_bytes, 4);
+    fseek(hal_host_wav_file, 0, SEEK_END);
+}
+
+static void hal_host_wav_open() {
+    const char *path = getenv("GENIUS_WAV");
+
+    if (path && !(hal_host_wav_file = fopen(path, "wb"))) {
+        fprintf(stderr, "%s não pôde ser criado\n", path);
+        exit(1);
+    }
+}
+
+static int64_t hal_host_pcm_finish() {
+    hal_host_pcm_playing = false;
+    if (hal_host_pcm_done) {
+        hal_host_pcm_done();
+    }
+    return 0;
+}
+
+void hal_pcm_init(uint pin) {
+}
+
+void hal_pcm_start(uint sample_rate, hal_pcm_refill_t refill, hal_pcm_done_t done) {
+    uint16_t levels[hal_pcm_block];
+    uint32_t samples = 0;
+    uint count;
+    bool recorded = hal_host_wav_file && (hal_host_wav_rate == 0 || hal_host_wav_rate == sample_rate);
+
+    hal_pcm_stop();
+    if (recorded && hal_host_wav_rate == 0) {
+        hal_host_wav_rate = sample_rate;
+        hal_host_wav_header();
+    }
+
+    do {
+        count = refill(levels, hal_pcm_block);
+        for (uint i = 0; recorded && i < count; i++) {
+            // O nível do PWM sem a componente contínua (metade do ciclo), na escala de 16 bits
+            hal_host_wav_put((uint16_t) (((int32_t) levels[i] - (int32_t) (hal_pwm_wrap + 1) / 2) * 16), 2);
+        }
+        samples += count;
+    } while (count == hal_pcm_block);
+
+    if (recorded) {
+        hal_host_wav_samples += samples;
+        hal_host_wav_header();
+    } else if (hal_host_wav_file) {
+        fprintf(stderr, "wav: som a %u Hz fora do arquivo (gravado a %lu Hz)\n", sample_rate,
+                (unsigned long) hal_host_wav_rate);
+    }
+    if (hal_host_trace) {
+        hal_host_log("pcm: %lu amostras a %u Hz (%lu ms)", (unsigned long) samples, sample_rate,
+                     (unsigned long) ((uint64_t) samples * 1000 / sample_rate));
+    }
+
+    hal_host_pcm_done = done;
+    hal_host_pcm_playing = true;
+    hal_host_pcm_alarm = hal_alarm_start((uint64_t) samples * 1000000 / sample_rate, hal_host_pcm_finish);
+}
+
+bool hal_pcm_busy() {
+    return hal_host_pcm_playing;
+}
+
+void hal_pcm_stop() {
+    if (hal_host_pcm_playing) {
+        hal_alarm_cancel(hal_host_pcm_alarm);
+        hal_host_pcm_playing = false;
+    }
+}
+
+static bool hal_host_adc_running = false;
+
+void hal_adc_stream_init(uint x_pin, uint y_pin, uint16_t *ring, uint ring_length, uint sample_rate) {
+    hal_host_power_update();
+    hal_host_adc_ring = ring;
+    hal_host_adc_length = ring_length;
+    hal_host_adc_running = true;
+}
+
+void hal_adc_stream_enable(bool enabled) {
+    hal_host_power_update();
+    hal_host_adc_running = enabled;
+    if (hal_host_trace) {
+        hal_host_log("adc %s", enabled ? "ligado" : "parado");
+    }
+}
+
+// O anel inteiro reflete a posição atual do joystick simulado
+uint hal_adc_stream_position() {
+    for (uint i = 0; i + 1 < hal_host_adc_length; i += 2) {
+        hal_host_adc_ring[i] = hal_host_joystick_x;
+        hal_host_adc_ring[i + 1] = hal_host_joystick_y;
+    }
+    return 0;
+}
+
+// ----------------------------------------------------------------------------------------------
+// Barramento I2C
+
+void hal_i2c_init(uint bus, uint sda, uint scl, uint baudrate) {
+    hal_host_buses[bus].baudrate = baudrate;
+}
+
+int hal_i2c_write(uint bus, uint8_t address, const uint8_t *head, size_t head_length,
+                  const uint8_t *data, size_t data_length) {
+    uint8_t bytes[head_length + data_length];
+
+    memcpy(bytes, head, head_length);
+    if (data_length) {
+        memcpy(bytes + head_length, data, data_length);
+    }
+    hal_host_i2c_receive(bus, address, bytes, sizeof(bytes));
+    return sizeof(bytes);
+}
+
+void hal_i2c_async_init(uint bus) {
+}
+
+// Entrega o fluxo inteiro na hora, separando as transações pelos STOPs, e avisa o fim em seguida
+void hal_i2c_write_async(uint bus, uint8_t address, const uint16_t *stream, uint words, hal_i2c_done_t done) {
+    uint8_t bytes[words];
+    uint length = 0;
+
+    for (uint i = 0; i < words; i++) {
+        bytes[length++] = stream[i] & 0xFF;
+        if ((stream[i] & hal_i2c_stop) || i == words - 1) {
+            hal_host_i2c_receive(bus, address, bytes, length);
+            length = 0;
+        }
+    }
+    if (done) {
+        done(true);
+    }
+}
+
+// ----------------------------------------------------------------------------------------------
+// Flash simulada: começa apagada (0xFF) ou com o conteúdo do arquivo em GENIUS_FLASH, que é
+// regravado a cada alteração (assim o registro sobrevive entre execuções, como num desligamento)
+
+static uint8_t hal_host_flash[hal_flash_data_size];
+static const char *hal_host_flash_path = NULL;
+static hal_host_flash_stats_t hal_host_flash_counters;
+
+static void hal_host_flash_load() {
+    memset(hal_host_flash, 0xFF, sizeof(hal_host_flash));
+    hal_host_flash_path = getenv("GENIUS_FLASH");
+    if (!hal_host_flash_path) {
+        return;
+    }
+
+    FILE *file = fopen(hal_host_flash_path, "rb");
+    if (file) {
+        if (fread(hal_host_flash, 1, sizeof(hal_host_flash), file) != sizeof(hal_host_flash)) {
+            memset(hal_host_flash, 0xFF, sizeof(hal_host_flash)); // Arquivo de outro tamanho: flash nova
+        }
+        fclose(file);
+    }
+}
+
+static void hal_host_flash_save() {
+    FILE *file = hal_host_flash_path ? fopen(hal_host_flash_path, "wb") : NULL;
+
+    if (file) {
+        fwrite(hal_host_flash, 1, sizeof(hal_host_flash), file);
+        fclose(file);
+    }
+}
+
+const uint8_t *hal_flash_data() {
+    return hal_host_flash;
+}
+
+// Como no RP2040, o programa fica parado durante o apagamento: o relógio virtual salta a pausa
+void hal_flash_erase(uint32_t offset, uint32_t length) {
+    assert(offset % hal_flash_sector_size == 0 && length % hal_flash_sector_size == 0);
+    assert(offset + length <= hal_flash_data_size);
+
+    memset(&hal_host_flash[offset], 0xFF, length);
+    for (uint32_t sector = offset / hal_flash_sector_size; sector < (offset + length) / hal_flash_sector_size; sector++) {
+        hal_host_flash_counters.erases++;
+        hal_host_flash_counters.sector_erases[sector]++;
+        hal_host_now += hal_host_flash_erase_us;
+    }
+    if (hal_host_trace) {
+        hal_host_log("flash: apaga %lu bytes em 0x%05lX", (unsigned long) length, (unsigned long) offset);
+    }
+    hal_host_flash_save();
+}
+
+// Gravação de NOR: cada bit só pode ir de 1 para 0 (regravar uma página apenas acrescenta zeros)
+void hal_flash_program(uint32_t offset, const uint8_t *data, uint32_t length) {
+    assert(offset % hal_flash_page_size == 0 && length % hal_flash_page_size == 0);
+    assert(offset + length <= hal_flash_data_size);
+
+    for (uint32_t i = 0; i < length; i++) {
+        hal_host_flash[offset + i] &= data[i];
+    }
+    hal_host_flash_counters.pages += length / hal_flash_page_size;
+    hal_host_now += (length / hal_flash_page_size) * hal_host_flash_program_us;
+    if (hal_host_trace) {
+        hal_host_log("flash: grava %lu bytes em 0x%05lX", (unsigned long) length, (unsigned long) offset);
+    }
+    hal_host_flash_save();
+}
+
+void hal_flash_lockout_init() {
+}
+
+const hal_host_flash_stats_t *hal_host_flash_stats() {
+    return &hal_host_flash_counters;
+}
+
+// ----------------------------------------------------------------------------------------------
+// USB CDC simulada: sem GENIUS_TELEMETRY não há host conectado; com ele, os bytes vão para esse arquivo.
+// O buffer esvazia no ritmo do host (GENIUS_USB_RATE bytes/s, para simular um host lento)
+
+static FILE *hal_host_usb_file = NULL;
+static uint32_t hal_host_usb_rate_bps = hal_host_usb_rate;
+static uint64_t hal_host_usb_empty_us = 0; // Quando o host terá retirado tudo o que está no buffer
+static uint32_t hal_host_usb_bytes = 0;
+
+static void hal_host_usb_open() {
+    const char *path = getenv("GENIUS_TELEMETRY");
+    const char *rate = getenv("GENIUS_USB_RATE");
+
+    if (rate && atoi(rate) > 0) {
+        hal_host_usb_rate_bps = atoi(rate);
+    }
+    if (path && !(hal_host_usb_file = fopen(path, "wb"))) {
+        fprintf(stderr, "%s não pôde ser criado\n", path);
+        exit(1);
+    }
+}
+
+// O simulador só tem "terminal aberto" quando a telemetria vai para um arquivo (GENIUS_TELEMETRY)
+bool hal_usb_connected() {
+    return hal_host_usb_file != NULL;
+}
+
+uint hal_usb_write_available() {
+    if (!hal_host_usb_file) {
+        return 0;
+    }
+    if (hal_host_usb_empty_us <= hal_host_now) {
+        return hal_host_usb_fifo;
+    }
+
+    uint64_t queued = ((hal_host_usb_empty_us - hal_host_now) * hal_host_usb_rate_bps + 999999) / 1000000;
+    return queued >= hal_host_usb_fifo ? 0 : hal_host_usb_fifo - queued;
+}
+
+uint hal_usb_write(const uint8_t *data, uint length) {
+    length = MIN(length, hal_usb_write_available());
+    if (length) {
+        fwrite(data, 1, length, hal_host_usb_file);
+        hal_host_usb_empty_us = MAX(hal_host_usb_empty_us, hal_host_now) +
+                                (uint64_t) length * 1000000 / hal_host_usb_rate_bps;
+        hal_host_usb_bytes += length;
+    }
+    return length;
+}
+
+// ----------------------------------------------------------------------------------------------
+// Energia: a corrente estimada de cada parte (hal_host.h) é integrada no relógio virtual. O tempo de
+// despertar vai da borda do botão até o display voltar a ligar
+
+static bool hal_host_dormant = false;
+static uint64_t hal_host_power_us = 0;      // Até onde o consumo já foi somado
+static double hal_host_charge = 0;          // µA·s desde o boot
+static double hal_host_dormant_charge = 0;  // µA·s só nos períodos dormentes
+static uint64_t hal_host_dormant_us = 0;
+static uint64_t hal_host_wake_edge_us = 0;  // Borda que acordou a placa (0 = nenhum despertar pendente)
+static uint32_t hal_host_wakes = 0;
+static uint32_t hal_host_wake_max_us = 0;
+
+static uint32_t hal_host_current_ua() {
+    uint32_t current = hal_host_dormant ? hal_host_current_dormant_ua : hal_host_current_awake_ua;
+
+    for (uint bus = 0; bus < count_of(hal_host_buses); bus++) {
+        for (uint i = 0; i < hal_host_max_panels; i++) {
+            if (hal_host_buses[bus].panels[i].used && hal_host_buses[bus].panels[i].display_on) {
+                current += hal_host_current_display_ua;
+            }
+        }
+    }
+    if (hal_host_adc_running && !hal_host_dormant) {
+        current += hal_host_current_adc_ua;
+    }
+    return current;
+}
+
+// Soma o consumo desde a última chamada; chamada antes de qualquer mudança de estado
+static void hal_host_power_update() {
+    double charge = hal_host_current_ua() * ((hal_host_now - hal_host_power_us) / 1e6);
+
+    hal_host_charge += charge;
+    if (hal_host_dormant) {
+        hal_host_dormant_charge += charge;
+        hal_host_dormant_us += hal_host_now - hal_host_power_us;
+    }
+    hal_host_power_us = hal_host_now;
+}
+
+static void hal_host_display_switched(bool on) {
+    if (on && hal_host_wake_edge_us) {
+        uint32_t latency = hal_host_now - hal_host_wake_edge_us;
+        hal_host_wake_max_us = MAX(hal_host_wake_max_us, latency);
+        hal_host_wake_edge_us = 0;
+        if (hal_host_trace) {
+            hal_host_log("display ligado %lu us depois do botão", (unsigned long) latency);
+        }
+    } else if (hal_host_trace) {
+        hal_host_log("display %s", on ? "ligado" : "desligado");
+    }
+}
+
+// ----------------------------------------------------------------------------------------------
+// Relógio virtual, alarmes e roteiro de eventos
+
+typedef struct {
+    bool active;
+    uint64_t time_us;
+    hal_alarm_callback_t callback;
+} hal_host_alarm_t;
+
+static hal_host_alarm_t hal_host_alarms[hal_host_max_alarms];
+
+// Linha do roteiro: "<tempo em ms> <comando> [argumentos]"
+typedef struct {
+    uint64_t time_us;
+    char command[16];
+    char argument[96];
+} hal_host_step_t;
+
+static hal_host_step_t *hal_host_script = NULL;
+static uint hal_host_script_length = 0;
+static uint hal_host_script_next = 0;
+static uint64_t hal_host_end_us = 1000000; // Sem "quit" no roteiro: encerra 1 s após o último evento
+
+void hal_init() {
+    const char *script = getenv("GENIUS_SCRIPT");
+
+    setvbuf(stdout, NULL, _IOLBF, 0);
+    hal_host_trace = getenv("GENIUS_TRACE") != NULL;
+    hal_host_flash_load();
+    hal_host_usb_open();
+    hal_host_wav_open();
+    if (script && !hal_host_load_script(script)) {
+        fprintf(stderr, "roteiro %s não pôde ser lido\n", script);
+        exit(1);
+    }
+}
+
+uint64_t hal_time_us() {
+    return hal_host_now;
+}
+
+void hal_wake() {
+    hal_host_event = true;
+}
+
+void hal_barrier() {
+}
+
+uint32_t hal_irq_disable() {
+    return 0;
+}
+
+void hal_irq_restore(uint32_t state) {
+}
+
+uint32_t hal_clock_hz() {
+    return hal_host_clock_hz;
+}
+
+void hal_alarm_init() {
+}
+
+int hal_alarm_start(uint64_t delay_us, hal_alarm_callback_t callback) {
+    for (int i = 0; i < hal_host_max_alarms; i++) {
+        if (!hal_host_alarms[i].active) {
+            hal_host_alarms[i].active = true;
+            hal_host_alarms[i].time_us = hal_host_now + delay_us;
+            hal_host_alarms[i].callback = callback;
+            return i + 1;
+        }
+    }
+    return -1;
+}
+
+void hal_alarm_cancel(int alarm) {
+    if (alarm >= 1 && alarm <= hal_host_max_alarms) {
+        hal_host_alarms[alarm - 1].active = false;
+    }
+}
+
+static void hal_host_fire_alarm(hal_host_alarm_t *alarm) {
+    int64_t next = alarm->callback();
+
+    if (next < 0) {
+        alarm->time_us -= next; // A partir do prazo anterior
+    } else if (next > 0) {
+        alarm->time_us = hal_host_now + next;
+    } else {
+        alarm->active = false;
+    }
+}
+
+// Lê o roteiro inteiro; linhas vazias e iniciadas por '#' são ignoradas. Cada linha tem o instante
+// (ms desde o boot) e um comando: "press <pino>", "release <pino>", "joystick <x> <y>", "show" (painel
+// em texto), "dump <arquivo.pbm>", "stats" (contadores do I2C) ou "quit"
+bool hal_host_load_script(const char *path) {
+    FILE *file = fopen(path, "r");
+    char line[160];
+    uint capacity = 0;
+
+    if (!file) {
+        return false;
+    }
+
+    while (fgets(line, sizeof(line), file)) {
+        hal_host_step_t step = { 0 };
+        double time_ms;
+
+        line[strcspn(line, "\r\n")] = '\0';
+        if (line[0] == '#' || sscanf(line, "%lf %15s %95[^\n]", &time_ms, step.command, step.argument) < 2) {
+            continue;
+        }
+        step.time_us = (uint64_t) (time_ms * 1000);
+
+        if (hal_host_script_length == capacity) {
+            capacity = capacity ? capacity * 2 : 32;
+            hal_host_script = realloc(hal_host_script, capacity * sizeof(hal_host_step_t));
+        }
+        hal_host_script[hal_host_script_length++] = step;
+        if (step.time_us + 1000000 > hal_host_end_us) {
+            hal_host_end_us = step.time_us + 1000000;
+        }
+    }
+    fclose(file);
+    return true;
+}
+
+static void hal_host_print_stats() {
+    for (uint bus = 0; bus < count_of(hal_host_buses); bus++) {
+        const hal_host_i2c_stats_t *stats = &hal_host_buses[bus].stats;
+        if (stats->transactions) {
+            hal_host_log("i2c%u: %lu transações, %lu bytes (%lu comandos, %lu de pixels), %llu us no barramento",
+                         bus, (unsigned long) stats->transactions, (unsigned long) stats->bytes,
+                         (unsigned long) stats->commands, (unsigned long) stats->pixels,
+                         (unsigned long long) stats->bus_us);
+        }
+    }
+
+    const hal_host_flash_stats_t *flash = &hal_host_flash_counters;
+    if (flash->erases || flash->pages) {
+        uint32_t worst = 0;
+        for (uint i = 0; i < count_of(flash->sector_erases); i++) {
+            worst = MAX(worst, flash->sector_erases[i]);
+        }
+        hal_host_log("flash: %lu setores apagados (no máximo %lu no mesmo setor), %lu páginas gravadas",
+                     (unsigned long) flash->erases, (unsigned long) worst, (unsigned long) flash->pages);
+    }
+
+    if (hal_host_usb_bytes) {
+        hal_host_log("usb: %lu bytes enviados", (unsigned long) hal_host_usb_bytes);
+    }
+
+    hal_host_power_update();
+    if (hal_host_now) {
+        hal_host_log("energia: %.2f mA em média, %.3f mAh", hal_host_charge / (hal_host_now / 1e6) / 1000,
+                     hal_host_charge / 3600 / 1000);
+    }
+    if (hal_host_dormant_us) {
+        hal_host_log("dormente: %.1f s a %.2f mA; %lu despertares, display ligado até %lu us depois do botão",
+                     hal_host_dormant_us / 1e6, hal_host_dormant_charge / (hal_host_dormant_us / 1e6) / 1000,
+                     (unsigned long) hal_host_wakes, (unsigned long) hal_host_wake_max_us);
+    }
+}
+
+static void hal_host_quit() {
+    hal_host_print_stats();
+    exit(0);
+}
+
+static void hal_host_run_step(const hal_host_step_t *step) {
+    uint pin;
+    unsigned x, y;
+
+    if (strcmp(step->command, "press") == 0 && sscanf(step->argument, "%u", &pin) == 1) {
+        hal_host_set_button(pin, true);
+    } else if (strcmp(step->command, "release") == 0 && sscanf(step->argument, "%u", &pin) == 1) {
+        hal_host_set_button(pin, false);
+    } else if (strcmp(step->command, "joystick") == 0 && sscanf(step->argument, "%u %u", &x, &y) == 2) {
+        hal_host_set_joystick(x, y);
+    } else if (strcmp(step->command, "show") == 0) {
+        hal_host_log("display:");
+        hal_host_panel_dump_ascii(ssd1306_i2c_bus, ssd1306_i2c_address, stdout);
+    } else if (strcmp(step->command, "dump") == 0) {
+        if (!hal_host_panel_dump_pbm(ssd1306_i2c_bus, ssd1306_i2c_address, step->argument)) {
+            hal_host_log("dump %s falhou", step->argument);
+        }
+    } else if (strcmp(step->command, "stats") == 0) {
+        hal_host_print_stats();
+    } else if (strcmp(step->command, "quit") == 0) {
+        hal_host_quit();
+    } else {
+        hal_host_log("comando desconhecido no roteiro: %s %s", step->command, step->argument);
+    }
+}
+
+// Modo dormente: sem clocks não há alarmes, então o relógio salta de evento em evento do roteiro
+// (aplicando-os) até o pressionamento do pino. Como no RP2040, esse pressionamento só muda o nível do
+// pino, sem interrupção de borda: o retorno true o representa. Com a USB simulada conectada
+// (GENIUS_TELEMETRY) a placa não dorme
+bool hal_dormant_until_edge(uint pin) {
+    uint step_pin;
+
+    if (hal_host_usb_file) {
+        return false;
+    }
+
+    hal_host_power_update();
+    hal_host_dormant = true;
+    if (hal_host_trace) {
+        hal_host_log("dormente até o pino %u", pin);
+    }
+
+    while (true) {
+        if (hal_host_script_next >= hal_host_script_length) {
+            hal_host_quit();
+        }
+
+        const hal_host_step_t *step = &hal_host_script[hal_host_script_next++];
+        if (step->time_us > hal_host_now) {
+            hal_host_now = step->time_us;
+        }
+
+        bool wake = strcmp(step->command, "press") == 0 && sscanf(step->argument, "%u", &step_pin) == 1 &&
+                    step_pin == pin && hal_gpio_get(pin);
+        if (wake) {
+            hal_host_power_update();
+            hal_host_dormant = false;
+            hal_host_wake_edge_us = hal_host_now;
+            hal_host_wakes++;
+            hal_host_now += hal_host_dormant_wake_us;
+            hal_host_levels[pin] = false;
+            return true;
+        }
+        hal_host_run_step(step);
+    }
+}
+
+// "Dorme" até o prazo: avança o relógio virtual até o primeiro entre o prazo, o próximo alarme e o
+// próximo evento do roteiro. Alarmes e eventos fazem o papel das interrupções que acordam o WFE
+void hal_wait_until(uint64_t deadline_us) {
+    if (hal_host_event) {
+        hal_host_event = false;
+        return;
+    }
+
+    hal_host_alarm_t *alarm = NULL;
+    for (int i = 0; i < hal_host_max_alarms; i++) {
+        if (hal_host_alarms[i].active && (!alarm || hal_host_alarms[i].time_us < alarm->time_us)) {
+            alarm = &hal_host_alarms[i];
+        }
+    }
+
+    const hal_host_step_t *step = NULL;
+    if (hal_host_script_next < hal_host_script_length) {
+        step = &hal_host_script[hal_host_script_next];
+    }
+
+    uint64_t next = hal_host_end_us;
+    if (alarm && alarm->time_us < next) {
+        next = alarm->time_us;
+    }
+    if (step && step->time_us < next) {
+        next = step->time_us;
+    }
+
+    if (deadline_us < next) {
+        if (deadline_us > hal_host_now) {
+            hal_host_now = deadline_us;
+        }
+        return;
+    }
+
+    if (next > hal_host_now) {
+        hal_host_now = next;
+    }
+    if (alarm && alarm->time_us == next) {
+        hal_host_fire_alarm(alarm);
+    } else if (step && step->time_us == next) {
+        hal_host_script_next++;
+        hal_host_run_step(step);
+    } else {
+        hal_host_quit();
+    }
+}
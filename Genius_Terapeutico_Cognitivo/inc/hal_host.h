@@ -0,0 +1,53 @@
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "hal.h"
+
+#ifndef hal_host_inc_h
+#define hal_host_inc_h
+
+// Extensões do simulador (inc/hal_host.c): só existem na compilação para o PC
+
+#define hal_host_max_pins 32     // GPIOs simulados
+#define hal_host_max_alarms 8    // Alarmes ativos ao mesmo tempo
+#define hal_host_max_panels 4    // Displays emulados por barramento (um por endereço)
+#define hal_host_clock_hz 125000000 // Clock do sistema informado aos módulos
+#define hal_host_panel_frame_us 10000 // Período de quadro do painel emulado (cerca de 100 Hz)
+#define hal_host_flash_erase_us 45000 // Pausa típica de apagamento de um setor (o relógio avança)
+#define hal_host_flash_program_us 400 // Pausa típica de gravação de uma página
+#define hal_host_usb_fifo 256         // Buffer de envio da USB CDC (como o do TinyUSB)
+#define hal_host_usb_rate 64000       // Bytes/s que o host retira (um pacote de 64 bytes por quadro USB)
+#define hal_host_dormant_wake_us 1100 // Saída do modo dormente: partida do cristal e travamento das PLLs
+
+// Consumo estimado (µA) para o relatório de energia: ordens de grandeza das folhas de dados
+#define hal_host_current_awake_ua 22000   // RP2040 a 125 MHz com a USB, núcleos em WFE entre tarefas
+#define hal_host_current_dormant_ua 800   // Placa em modo dormente (reguladores e pull-ups)
+#define hal_host_current_display_ua 9000  // SSD1306 ligado com algumas linhas de texto
+#define hal_host_current_adc_ua 600       // ADC convertendo continuamente
+
+// Desgaste da flash simulada
+typedef struct {
+    uint32_t erases;                       // Setores apagados
+    uint32_t pages;                        // Páginas gravadas
+    uint32_t sector_erases[hal_flash_data_size / hal_flash_sector_size]; // Apagamentos por setor
+} hal_host_flash_stats_t;
+
+// Contadores de um barramento I2C simulado
+typedef struct {
+    uint32_t transactions;  // Transações (START ... STOP)
+    uint32_t bytes;         // Bytes escritos, sem contar o byte de endereço
+    uint32_t commands;      // Bytes interpretados pelo painel como comando (incluindo argumentos)
+    uint32_t pixels;        // Bytes gravados na GDDRAM do painel
+    uint64_t bus_us;        // Tempo estimado no barramento (9 bits por byte, mais START e STOP)
+} hal_host_i2c_stats_t;
+
+extern void hal_host_i2c_stats(uint bus, hal_host_i2c_stats_t *stats);
+extern void hal_host_i2c_reset_stats(uint bus);
+extern const uint8_t *hal_host_panel(uint bus, uint8_t address);
+extern bool hal_host_panel_dump_pbm(uint bus, uint8_t address, const char *path);
+extern void hal_host_panel_dump_ascii(uint bus, uint8_t address, FILE *out);
+extern void hal_host_set_button(uint pin, bool pressed);
+extern void hal_host_set_joystick(uint16_t x, uint16_t y);
+extern bool hal_host_load_script(const char *path);
+extern const hal_host_flash_stats_t *hal_host_flash_stats();
+
+#endif
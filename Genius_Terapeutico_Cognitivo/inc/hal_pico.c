@@ -0,0 +1,751 @@
+#include "pico/stdlib.h"
+#include "hardware/gpio.h"
+#include "hardware/pwm.h"
+#include "hardware/adc.h"
+#include "hardware/i2c.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/clocks.h"
+#include "hardware/sync.h"
+#include "hardware/flash.h"
+#include "hardware/xosc.h"
+#include "hardware/pll.h"
+#include "hardware/structs/rosc.h"
+#include "tusb.h"
+#include "hal.h"
+
+#if GENIUS_DUAL_CORE
+#include "pico/multicore.h"
+#endif
+
+// Inicializa a comunicação serial (USB)
+void hal_init() {
+    stdio_init_all();
+}
+
+uint64_t hal_time_us() {
+    return time_us_64();
+}
+
+// Dorme (WFE) até o prazo ou até um evento/interrupção; UINT64_MAX = sem prazo
+void hal_wait_until(uint64_t deadline_us) {
+    if (deadline_us == UINT64_MAX) {
+        __wfe();
+    } else {
+        best_effort_wfe_or_timeout(from_us_since_boot(deadline_us));
+    }
+}
+
+// Acorda quem estiver em hal_wait_until(), inclusive no outro núcleo
+void hal_wake() {
+    __sev();
+}
+
+void hal_barrier() {
+    __dmb();
+}
+
+uint32_t hal_irq_disable() {
+    return save_and_disable_interrupts();
+}
+
+void hal_irq_restore(uint32_t state) {
+    restore_interrupts(state);
+}
+
+uint32_t hal_clock_hz() {
+    return clock_get_hz(clk_sys);
+}
+
+// Modo dormente: o sistema passa a rodar do cristal, as PLLs, o oscilador em anel e os clocks da USB e
+// do ADC param, e então o cristal é desligado até a borda de descida no pino. O temporizador também
+// para (hal_time_us() não conta o tempo dormindo). Na volta, clocks_init() religa as PLLs (cerca de
+// 1 ms). Sem clocks a detecção normal de bordas está parada, então a borda que acordou a placa não vira
+// interrupção do pino: quem chamou trata o retorno true como o pressionamento (só a soltura chega
+// depois). Com um host USB conectado a placa não dorme (perderia a conexão) e retorna false na hora
+bool hal_dormant_until_edge(uint pin) {
+    if (tud_mounted()) {
+        return false;
+    }
+
+    uint32_t state = save_and_disable_interrupts();
+    clock_configure(clk_ref, CLOCKS_CLK_REF_CTRL_SRC_VALUE_XOSC_CLKSRC, 0, XOSC_MHZ * MHZ, XOSC_MHZ * MHZ);
+    clock_configure(clk_sys, CLOCKS_CLK_SYS_CTRL_SRC_VALUE_CLK_REF, 0, XOSC_MHZ * MHZ, XOSC_MHZ * MHZ);
+    clock_configure(clk_peri, 0, CLOCKS_CLK_PERI_CTRL_AUXSRC_VALUE_CLK_SYS, XOSC_MHZ * MHZ, XOSC_MHZ * MHZ);
+    clock_stop(clk_usb);
+    clock_stop(clk_adc);
+    clock_stop(clk_rtc);
+    pll_deinit(pll_sys);
+    pll_deinit(pll_usb);
+    hw_write_masked(&rosc_hw->ctrl, ROSC_CTRL_ENABLE_VALUE_DISABLE << ROSC_CTRL_ENABLE_LSB, ROSC_CTRL_ENABLE_BITS);
+
+    gpio_set_dormant_irq_enabled(pin, GPIO_IRQ_EDGE_FALL, true);
+    xosc_dormant();
+    gpio_set_dormant_irq_enabled(pin, GPIO_IRQ_EDGE_FALL, false);
+
+    hw_write_masked(&rosc_hw->ctrl, ROSC_CTRL_ENABLE_VALUE_ENABLE << ROSC_CTRL_ENABLE_LSB, ROSC_CTRL_ENABLE_BITS);
+    clocks_init(); // Mesma configuração do boot: PLLs, clk_sys a 125 MHz, USB, ADC e periféricos
+    gpio_acknowledge_irq(pin, GPIO_IRQ_EDGE_FALL); // Uma borda registrada no despertar já foi entregue
+    restore_interrupts(state);
+    return true;
+}
+
+void hal_gpio_output(uint pin) {
+    gpio_init(pin);
+    gpio_set_dir(pin, GPIO_OUT);
+}
+
+void hal_gpio_put(uint pin, bool value) {
+    gpio_put(pin, value);
+}
+
+void hal_gpio_input_pullup(uint pin) {
+    gpio_init(pin);
+    gpio_set_dir(pin, GPIO_IN);
+    gpio_pull_up(pin);
+}
+
+bool hal_gpio_get(uint pin) {
+    return gpio_get(pin);
+}
+
+// Habilita as interrupções nas duas bordas do pino (o SDK tem um único callback de GPIO por núcleo)
+void hal_gpio_edge_irq(uint pin, hal_edge_callback_t callback) {
+    gpio_set_irq_enabled_with_callback(pin, GPIO_IRQ_EDGE_FALL | GPIO_IRQ_EDGE_RISE, true, (gpio_irq_callback_t) callback);
+}
+
+// Coloca o pino em PWM com o wrap comum, inicialmente em nível 0. Um slice já ligado por outro
+// pino (o buzzer e o LED verde dividem o slice 5) fica com o divisor que estiver usando
+void hal_pwm_init(uint pin) {
+    uint slice = pwm_gpio_to_slice_num(pin);
+
+    if (!(pwm_hw->slice[slice].csr & PWM_CH0_CSR_EN_BITS)) {
+        pwm_config config = pwm_get_default_config();
+        pwm_config_set_wrap(&config, hal_pwm_wrap);
+        pwm_init(slice, &config, true);
+    }
+    pwm_set_gpio_level(pin, 0);
+    gpio_set_function(pin, GPIO_FUNC_PWM);
+}
+
+// Troca divisor e nível sem deixar o pino ativo com a configuração intermediária
+void hal_pwm_set(uint pin, uint8_t div_int, uint8_t div_frac, uint16_t level) {
+    pwm_set_gpio_level(pin, 0);
+    pwm_set_clkdiv_int_frac(pwm_gpio_to_slice_num(pin), div_int, div_frac);
+    pwm_set_gpio_level(pin, level);
+}
+
+void hal_pwm_level(uint pin, uint16_t level) {
+    pwm_set_gpio_level(pin, level);
+}
+
+// Liga ou para o contador do slice do pino (parado, a saída fica no último nível)
+void hal_pwm_enable(uint pin, bool enabled) {
+    pwm_set_enabled(pwm_gpio_to_slice_num(pin), enabled);
+}
+
+// Animação de níveis sem a CPU: a cada wrap do slice marca-passo (sem pinos em uso: GPIO 14 e 15
+// são do I2C) um canal de DMA por slice aplica no registrador CC o XOR entre um quadro e o
+// seguinte. Pelo alias XOR do registrador, o canal do slice que não está na animação (o buzzer,
+// no slice 5) continua intocado
+
+#define hal_pwm_pacer_slice 7
+#define hal_pwm_max_slices 2 // Slices distintos numa mesma animação (o LED RGB usa os slices 5 e 6)
+
+static uint32_t hal_pwm_deltas[hal_pwm_max_slices][hal_pwm_max_frames];
+static int hal_pwm_channels[hal_pwm_max_slices] = { -1, -1 };
+static uint hal_pwm_channel_mask = 0; // Canais da animação em andamento
+
+// Toca frames quadros de count níveis (um por pino, na ordem de pins), cada um por frame_us.
+// O quadro 0 vale imediatamente; a tabela precisa continuar válida só até esta função retornar
+void hal_pwm_play(const uint *pins, uint count, const uint16_t *levels, uint frames, uint32_t frame_us) {
+    uint slices[hal_pwm_max_slices];
+    uint slice_of[count];
+    uint slice_count = 0;
+
+    hal_pwm_play_stop();
+    if (frames == 0) {
+        return;
+    }
+    if (frames > hal_pwm_max_frames) {
+        frames = hal_pwm_max_frames;
+    }
+
+    for (uint i = 0; i < count; i++) {
+        uint slice = pwm_gpio_to_slice_num(pins[i]);
+        uint s = 0;
+        while (s < slice_count && slices[s] != slice) {
+            s++;
+        }
+        if (s == slice_count) {
+            slices[slice_count++] = slice;
+        }
+        slice_of[i] = s;
+        pwm_set_gpio_level(pins[i], levels[i]);
+    }
+    if (frames == 1) {
+        return;
+    }
+
+    for (uint s = 0; s < slice_count; s++) {
+        for (uint f = 1; f < frames; f++) {
+            hal_pwm_deltas[s][f - 1] = 0;
+        }
+    }
+    for (uint i = 0; i < count; i++) {
+        uint shift = pwm_gpio_to_channel(pins[i]) == PWM_CHAN_B ? PWM_CH0_CC_B_LSB : PWM_CH0_CC_A_LSB;
+        for (uint f = 1; f < frames; f++) {
+            uint32_t delta = levels[f * count + i] ^ levels[(f - 1) * count + i];
+            hal_pwm_deltas[slice_of[i]][f - 1] |= delta << shift;
+        }
+    }
+
+    // Marca-passo: menor divisor inteiro que deixa o período do quadro caber no contador de 16 bits
+    uint32_t cycles = (uint32_t) ((uint64_t) clock_get_hz(clk_sys) * frame_us / 1000000);
+    uint32_t divider = cycles / 0x10000 + 1;
+    pwm_config pacer = pwm_get_default_config();
+    pwm_config_set_clkdiv_int(&pacer, divider);
+    pwm_config_set_wrap(&pacer, cycles / divider - 1);
+    pwm_init(hal_pwm_pacer_slice, &pacer, false);
+
+    for (uint s = 0; s < slice_count; s++) {
+        if (hal_pwm_channels[s] < 0) {
+            hal_pwm_channels[s] = dma_claim_unused_channel(true);
+        }
+
+        dma_channel_config config = dma_channel_get_default_config(hal_pwm_channels[s]);
+        channel_config_set_transfer_data_size(&config, DMA_SIZE_32);
+        channel_config_set_read_increment(&config, true);
+        channel_config_set_write_increment(&config, false);
+        channel_config_set_dreq(&config, DREQ_PWM_WRAP0 + hal_pwm_pacer_slice);
+        dma_channel_configure(hal_pwm_channels[s], &config, hw_xor_alias(&pwm_hw->slice[slices[s]].cc),
+                              hal_pwm_deltas[s], frames - 1, false);
+        hal_pwm_channel_mask |= 1u << hal_pwm_channels[s];
+    }
+
+    dma_start_channel_mask(hal_pwm_channel_mask);
+    pwm_set_enabled(hal_pwm_pacer_slice, true);
+}
+
+// Indica se a animação ainda não aplicou o último quadro
+bool hal_pwm_play_busy() {
+    for (uint s = 0; s < hal_pwm_max_slices; s++) {
+        int channel = hal_pwm_channels[s];
+        if (channel >= 0 && (hal_pwm_channel_mask & (1u << channel)) && dma_channel_is_busy(channel)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Interrompe a animação; os pinos ficam no último quadro aplicado
+void hal_pwm_play_stop() {
+    pwm_set_enabled(hal_pwm_pacer_slice, false);
+    for (uint s = 0; s < hal_pwm_max_slices; s++) {
+        int channel = hal_pwm_channels[s];
+        if (channel >= 0 && (hal_pwm_channel_mask & (1u << channel))) {
+            dma_channel_abort(channel);
+        }
+    }
+    hal_pwm_channel_mask = 0;
+}
+
+// Amostras no buzzer: o PWM fica no divisor 1 (portadora de 30 kHz, acima da audição) e dois
+// canais de DMA encadeados em pingue-pongue, no ritmo de um timer de DMA, escrevem uma amostra
+// por período. Como no LED, cada palavra é o XOR com a amostra anterior, escrito pelo alias XOR
+// do registrador CC: o LED verde, no outro canal do slice, não é afetado. Enquanto uma metade
+// toca, a interrupção do fim da outra a preenche de novo
+
+static uint hal_pcm_pin;
+static int hal_pcm_channels[2] = { -1, -1 };
+static int hal_pcm_timer = -1;
+static uint32_t hal_pcm_buffers[2][hal_pcm_block];
+static uint16_t hal_pcm_levels[hal_pcm_block];
+static uint16_t hal_pcm_level;             // Nível depois da última amostra já montada
+static hal_pcm_refill_t hal_pcm_refill;
+static hal_pcm_done_t hal_pcm_done;
+static volatile bool hal_pcm_playing = false;
+static volatile int hal_pcm_last_half = -1; // Metade com as últimas amostras (-1 = o som continua)
+
+// Pede as próximas amostras, monta os deltas na metade e a deixa pronta para ser disparada pela
+// outra. A metade com o fim do som não encadeia ninguém (encadear a si mesmo desliga o encadeamento)
+static bool hal_pcm_prepare(uint half) {
+    uint count = hal_pcm_refill(hal_pcm_levels, hal_pcm_block);
+    uint shift = pwm_gpio_to_channel(hal_pcm_pin) == PWM_CHAN_B ? PWM_CH0_CC_B_LSB : PWM_CH0_CC_A_LSB;
+    bool more = count == hal_pcm_block;
+
+    for (uint i = 0; i < count; i++) {
+        hal_pcm_buffers[half][i] = (uint32_t) (hal_pcm_levels[i] ^ hal_pcm_level) << shift;
+        hal_pcm_level = hal_pcm_levels[i];
+    }
+    if (count == 0) {
+        hal_pcm_buffers[half][count++] = 0; // Metade vazia: um delta nulo só para chegar ao fim
+    }
+
+    int channel = hal_pcm_channels[half];
+    dma_channel_config config = dma_channel_get_default_config(channel);
+    channel_config_set_transfer_data_size(&config, DMA_SIZE_32);
+    channel_config_set_read_increment(&config, true);
+    channel_config_set_write_increment(&config, false);
+    channel_config_set_dreq(&config, dma_get_timer_dreq(hal_pcm_timer));
+    channel_config_set_chain_to(&config, more ? hal_pcm_channels[1 - half] : channel);
+    dma_channel_configure(channel, &config, hw_xor_alias(&pwm_hw->slice[pwm_gpio_to_slice_num(hal_pcm_pin)].cc),
+                          hal_pcm_buffers[half], count, false);
+
+    if (!more) {
+        hal_pcm_last_half = half;
+    }
+    return more;
+}
+
+// Uma metade terminou (a outra já está tocando): encerra o som ou prepara a metade de novo
+static void hal_pcm_irq_handler() {
+    for (uint half = 0; half < 2; half++) {
+        int channel = hal_pcm_channels[half];
+        if (channel < 0 || !dma_channel_get_irq1_status(channel)) {
+            continue;
+        }
+        dma_channel_acknowledge_irq1(channel);
+        if (!hal_pcm_playing) {
+            continue;
+        }
+
+        if (hal_pcm_last_half == (int) half) {
+            hal_pcm_playing = false;
+            pwm_set_gpio_level(hal_pcm_pin, 0);
+            if (hal_pcm_done) {
+                hal_pcm_done();
+            }
+        } else if (hal_pcm_last_half < 0) {
+            hal_pcm_prepare(half);
+        }
+    }
+}
+
+// Reserva os canais de DMA, o timer de ritmo e a interrupção (DMA_IRQ_1, no núcleo que chamar
+// esta função, a mesma do envio assíncrono do display) para tocar amostras no pino já em PWM
+void hal_pcm_init(uint pin) {
+    hal_pcm_pin = pin;
+    if (hal_pcm_timer >= 0) {
+        return;
+    }
+
+    hal_pcm_timer = dma_claim_unused_timer(true);
+    for (uint half = 0; half < 2; half++) {
+        hal_pcm_channels[half] = dma_claim_unused_channel(true);
+        dma_channel_set_irq1_enabled(hal_pcm_channels[half], true);
+    }
+    irq_add_shared_handler(DMA_IRQ_1, hal_pcm_irq_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_1, true);
+}
+
+// Começa a tocar amostras na taxa pedida (8 a 16 kHz) e retorna imediatamente. refill é chamada
+// agora para as duas metades e depois a cada hal_pcm_block amostras tocadas
+void hal_pcm_start(uint sample_rate, hal_pcm_refill_t refill, hal_pcm_done_t done) {
+    hal_pcm_stop();
+
+    // Fração X/Y do clock mais próxima da taxa, com X e Y de 16 bits
+    uint32_t clock = clock_get_hz(clk_sys);
+    uint32_t best_x = 1;
+    uint32_t best_y = clock / sample_rate;
+    uint32_t best_error = UINT32_MAX;
+    for (uint32_t x = 1; x <= 16; x++) {
+        uint32_t y = (uint32_t) (((uint64_t) clock * x + sample_rate / 2) / sample_rate);
+        if (y > 0xFFFF) {
+            break;
+        }
+        uint32_t rate = (uint32_t) ((uint64_t) clock * x / y);
+        uint32_t error = rate > sample_rate ? rate - sample_rate : sample_rate - rate;
+        if (error < best_error) {
+            best_x = x;
+            best_y = y;
+            best_error = error;
+        }
+    }
+    dma_timer_set_fraction(hal_pcm_timer, best_x, best_y);
+
+    hal_pwm_set(hal_pcm_pin, 1, 0, 0);
+    hal_pcm_level = 0;
+    hal_pcm_refill = refill;
+    hal_pcm_done = done;
+    hal_pcm_last_half = -1;
+    hal_pcm_playing = true;
+
+    if (hal_pcm_prepare(0)) {
+        hal_pcm_prepare(1);
+    }
+    dma_channel_start(hal_pcm_channels[0]);
+}
+
+bool hal_pcm_busy() {
+    return hal_pcm_playing;
+}
+
+// Interrompe o som (sem chamar done) e silencia o buzzer
+void hal_pcm_stop() {
+    if (hal_pcm_timer < 0) {
+        return;
+    }
+
+    hal_pcm_playing = false;
+    // Desfaz o encadeamento antes de abortar, senão um canal abortado pode disparar o outro
+    for (uint half = 0; half < 2; half++) {
+        dma_channel_config config = dma_get_channel_config(hal_pcm_channels[half]);
+        channel_config_set_chain_to(&config, hal_pcm_channels[half]);
+        dma_channel_set_config(hal_pcm_channels[half], &config, false);
+    }
+    for (uint half = 0; half < 2; half++) {
+        dma_channel_abort(hal_pcm_channels[half]);
+    }
+    pwm_set_gpio_level(hal_pcm_pin, 0);
+}
+
+static alarm_pool_t *hal_alarm_pool = NULL; // Os alarmes disparam no núcleo dono deste pool
+
+// Os alarmes passam a ser atendidos no núcleo que chamar esta função
+void hal_alarm_init() {
+    hal_alarm_pool = alarm_pool_create_with_unused_hardware_alarm(4);
+}
+
+static int64_t hal_alarm_trampoline(alarm_id_t id, void *user_data) {
+    return ((hal_alarm_callback_t) user_data)();
+}
+
+// Agenda o callback daqui a delay_us (em contexto de interrupção); retorna o identificador do alarme
+int hal_alarm_start(uint64_t delay_us, hal_alarm_callback_t callback) {
+    if (!hal_alarm_pool) {
+        hal_alarm_pool = alarm_pool_get_default();
+    }
+    return alarm_pool_add_alarm_in_us(hal_alarm_pool, delay_us, hal_alarm_trampoline, (void *) callback, true);
+}
+
+void hal_alarm_cancel(int alarm) {
+    alarm_pool_cancel_alarm(hal_alarm_pool, alarm);
+}
+
+static int hal_adc_dma_channel = -1;
+
+// Recarrega o contador de transferências quando ele se esgota (a cada ~6 dias a 8 kHz)
+static void hal_adc_dma_irq_handler() {
+    if (hal_adc_dma_channel < 0 || !dma_channel_get_irq0_status(hal_adc_dma_channel)) {
+        return;
+    }
+    dma_channel_acknowledge_irq0(hal_adc_dma_channel);
+    dma_channel_set_trans_count(hal_adc_dma_channel, UINT32_MAX, true);
+}
+
+static uint16_t *hal_adc_ring;
+
+// Coloca o ADC em round-robin nos dois canais, com o DMA esvaziando a FIFO no anel.
+// O anel precisa estar alinhado ao próprio tamanho (em bytes, potência de 2) para o wrap do DMA
+void hal_adc_stream_init(uint x_pin, uint y_pin, uint16_t *ring, uint ring_length, uint sample_rate) {
+    uint x_input = x_pin - 26;
+    uint y_input = y_pin - 26;
+
+    adc_init();
+    adc_gpio_init(x_pin);
+    adc_gpio_init(y_pin);
+
+    // O round-robin percorre os canais em ordem crescente a partir do selecionado
+    assert(x_input < y_input);
+    adc_select_input(x_input);
+    adc_set_round_robin((1u << x_input) | (1u << y_input));
+    adc_fifo_setup(true, true, 1, false, false);
+    adc_set_clkdiv(48000000.0f / sample_rate - 1);
+
+    hal_adc_ring = ring;
+    hal_adc_dma_channel = dma_claim_unused_channel(true);
+    dma_channel_config config = dma_channel_get_default_config(hal_adc_dma_channel);
+    channel_config_set_transfer_data_size(&config, DMA_SIZE_16);
+    channel_config_set_read_increment(&config, false);
+    channel_config_set_write_increment(&config, true);
+    channel_config_set_ring(&config, true, __builtin_ctz(ring_length * sizeof(uint16_t)));
+    channel_config_set_dreq(&config, DREQ_ADC);
+    dma_channel_configure(hal_adc_dma_channel, &config, ring, &adc_hw->fifo, UINT32_MAX, true);
+
+    dma_channel_set_irq0_enabled(hal_adc_dma_channel, true);
+    irq_add_shared_handler(DMA_IRQ_0, hal_adc_dma_irq_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_0, true);
+
+    adc_fifo_drain();
+    adc_run(true);
+}
+
+// Posição do anel que o DMA está escrevendo agora
+uint hal_adc_stream_position() {
+    return (dma_channel_hw_addr(hal_adc_dma_channel)->write_addr - (uintptr_t) hal_adc_ring) / sizeof(uint16_t);
+}
+
+// Para ou retoma as conversões, desligando a parte analógica do ADC. O DMA continua armado e a
+// conversão em andamento termina antes, então a alternância X/Y do anel segue de onde parou
+void hal_adc_stream_enable(bool enabled) {
+    if (enabled) {
+        hw_set_bits(&adc_hw->cs, ADC_CS_EN_BITS);
+        while (!(adc_hw->cs & ADC_CS_READY_BITS)) {
+            tight_loop_contents();
+        }
+        adc_run(true);
+    } else {
+        adc_run(false);
+        while (!(adc_hw->cs & ADC_CS_READY_BITS)) {
+            tight_loop_contents();
+        }
+        hw_clear_bits(&adc_hw->cs, ADC_CS_EN_BITS);
+    }
+}
+
+void hal_i2c_init(uint bus, uint sda, uint scl, uint baudrate) {
+    i2c_init(i2c_get_instance(bus), baudrate);
+    gpio_set_function(sda, GPIO_FUNC_I2C);
+    gpio_set_function(scl, GPIO_FUNC_I2C);
+    gpio_pull_up(sda);
+    gpio_pull_up(scl);
+}
+
+// Escreve cabeçalho e dados numa única transação I2C (um START, um STOP), alimentando a FIFO
+// diretamente para não precisar juntar os dois trechos num buffer temporário.
+// Retorna o número de bytes ou negativo se o dispositivo não respondeu
+int hal_i2c_write(uint bus, uint8_t address, const uint8_t *head, size_t head_length,
+                  const uint8_t *data, size_t data_length) {
+    i2c_inst_t *i2c = i2c_get_instance(bus);
+    i2c_hw_t *hw = i2c_get_hw(i2c);
+    size_t total = head_length + data_length;
+
+    hw->enable = 0;
+    hw->tar = address;
+    hw->enable = 1;
+
+    // Nada foi enviado ainda: descarta STOP e abort deixados por envios anteriores (assíncronos ou
+    // abortados), senão a espera abaixo terminaria antes do STOP desta transação
+    (void) hw->clr_stop_det;
+    (void) hw->clr_tx_abrt;
+
+    for (size_t i = 0; i < total; i++) {
+        uint8_t byte = i < head_length ? head[i] : data[i - head_length];
+
+        while (!i2c_get_write_available(i2c)) {
+            if (hw->raw_intr_stat & I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS) {
+                break;
+            }
+        }
+        hw->data_cmd = byte | (i == total - 1 ? I2C_IC_DATA_CMD_STOP_BITS : 0);
+    }
+
+    // Aguarda o STOP (gerado também quando o dispositivo não responde)
+    while (!(hw->raw_intr_stat & I2C_IC_RAW_INTR_STAT_STOP_DET_BITS)) {
+        tight_loop_contents();
+    }
+    (void) hw->clr_stop_det;
+
+    if (hw->raw_intr_stat & I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS) {
+        (void) hw->clr_tx_abrt;
+        return PICO_ERROR_GENERIC;
+    }
+    return total;
+}
+
+// Escrita assíncrona por barramento: um canal de DMA alimenta IC_DATA_CMD com as palavras do fluxo
+typedef struct {
+    int dma_channel;
+    volatile bool dma_done;
+    hal_i2c_done_t done;
+} hal_i2c_async_t;
+
+static hal_i2c_async_t hal_i2c_async[NUM_I2CS] = { { -1 }, { -1 } };
+
+// Encerra a transferência: mascara as interrupções do I2C (para não interferir nas escritas
+// bloqueantes) e avisa quem pediu o envio
+static void hal_i2c_async_finish(uint bus, bool ok) {
+    i2c_hw_t *hw = i2c_get_hw(i2c_get_instance(bus));
+    hw->intr_mask = 0;
+    hw->dma_cr = 0;
+
+    if (hal_i2c_async[bus].done) {
+        hal_i2c_async[bus].done(ok);
+    }
+}
+
+// Barramento parado: FIFO vazia e nenhum byte sendo transmitido (o STOP final já saiu)
+static inline bool hal_i2c_idle(i2c_hw_t *hw) {
+    uint32_t status = hw->status;
+    return (status & I2C_IC_STATUS_TFE_BITS) && !(status & I2C_IC_STATUS_ACTIVITY_BITS);
+}
+
+// O DMA termina quando o último byte entra na FIFO; a conclusão real é o STOP final no barramento.
+// Este atendimento pode atrasar (gravação da flash, recarga do áudio no mesmo DMA_IRQ_1) até depois
+// desse STOP: por isso o STOP_DET não é limpo aqui. Ao desmascará-lo, um STOP já registrado gera a
+// interrupção na hora e hal_i2c_irq() confere se o barramento parou
+static void hal_i2c_dma_irq_handler() {
+    for (uint bus = 0; bus < NUM_I2CS; bus++) {
+        hal_i2c_async_t *async = &hal_i2c_async[bus];
+        if (async->dma_channel < 0 || !dma_channel_get_irq1_status(async->dma_channel)) {
+            continue;
+        }
+        dma_channel_acknowledge_irq1(async->dma_channel);
+
+        i2c_hw_t *hw = i2c_get_hw(i2c_get_instance(bus));
+        async->dma_done = true;
+        hw->intr_mask = I2C_IC_INTR_MASK_M_STOP_DET_BITS | I2C_IC_INTR_MASK_M_TX_ABRT_BITS;
+    }
+}
+
+static void hal_i2c_irq(uint bus) {
+    i2c_hw_t *hw = i2c_get_hw(i2c_get_instance(bus));
+    uint32_t status = hw->intr_stat;
+
+    if (status & I2C_IC_INTR_STAT_R_TX_ABRT_BITS) {
+        // Dispositivo não respondeu: descarta o restante do fluxo
+        (void) hw->clr_tx_abrt;
+        dma_channel_abort(hal_i2c_async[bus].dma_channel);
+        hal_i2c_async_finish(bus, false);
+        return;
+    }
+
+    if (status & I2C_IC_INTR_STAT_R_STOP_DET_BITS) {
+        // Limpa antes de ler o estado: um STOP final que chegar depois da leitura gera nova interrupção.
+        // STOPs intermediários (entre transações do fluxo) deixam dados na FIFO ou o barramento ativo
+        (void) hw->clr_stop_det;
+        if (hal_i2c_async[bus].dma_done && hal_i2c_idle(hw)) {
+            hal_i2c_async_finish(bus, true);
+        }
+    }
+}
+
+static void hal_i2c0_irq_handler() {
+    hal_i2c_irq(0);
+}
+
+static void hal_i2c1_irq_handler() {
+    hal_i2c_irq(1);
+}
+
+// Reserva o canal de DMA e as interrupções da escrita assíncrona no barramento (já inicializado).
+// As interrupções são habilitadas no núcleo que chamar esta função; usa DMA_IRQ_1 para não
+// disputar DMA_IRQ_0 com o ADC, atendido pelo outro núcleo
+void hal_i2c_async_init(uint bus) {
+    hal_i2c_async_t *async = &hal_i2c_async[bus];
+    if (async->dma_channel >= 0) {
+        return;
+    }
+
+    async->dma_channel = dma_claim_unused_channel(true);
+    dma_channel_set_irq1_enabled(async->dma_channel, true);
+    irq_add_shared_handler(DMA_IRQ_1, hal_i2c_dma_irq_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_1, true);
+
+    uint irq = bus ? I2C1_IRQ : I2C0_IRQ;
+    i2c_get_hw(i2c_get_instance(bus))->intr_mask = 0;
+    irq_set_exclusive_handler(irq, bus ? hal_i2c1_irq_handler : hal_i2c0_irq_handler);
+    irq_set_enabled(irq, true);
+}
+
+// Inicia o envio do fluxo (byte nos bits 0-7, hal_i2c_stop ao fim de cada transação) e retorna
+// imediatamente. O fluxo precisa continuar válido até done() ser chamado
+void hal_i2c_write_async(uint bus, uint8_t address, const uint16_t *stream, uint words, hal_i2c_done_t done) {
+    hal_i2c_async_t *async = &hal_i2c_async[bus];
+    i2c_inst_t *i2c = i2c_get_instance(bus);
+    i2c_hw_t *hw = i2c_get_hw(i2c);
+
+    hw->enable = 0;
+    hw->tar = address;
+    hw->enable = 1;
+    hw->dma_cr = I2C_IC_DMA_CR_TDMAE_BITS;
+    hw->intr_mask = 0;
+    (void) hw->clr_stop_det; // Nada foi enviado ainda: descarta STOPs antigos (escritas bloqueantes)
+
+    async->done = done;
+    async->dma_done = false;
+
+    dma_channel_config config = dma_channel_get_default_config(async->dma_channel);
+    channel_config_set_transfer_data_size(&config, DMA_SIZE_16);
+    channel_config_set_read_increment(&config, true);
+    channel_config_set_write_increment(&config, false);
+    channel_config_set_dreq(&config, i2c_get_dreq(i2c, true));
+    dma_channel_configure(async->dma_channel, &config, &hw->data_cmd, stream, words, true);
+}
+
+// ----------------------------------------------------------------------------------------------
+// Área de dados na flash: os últimos hal_flash_data_size bytes, longe do programa
+
+#define hal_flash_offset (PICO_FLASH_SIZE_BYTES - hal_flash_data_size)
+
+const uint8_t *hal_flash_data() {
+    return (const uint8_t *) (XIP_BASE + hal_flash_offset);
+}
+
+// Durante apagamento e gravação a flash não pode ser lida (XIP): o outro núcleo é pausado num laço
+// em RAM e as interrupções deste núcleo ficam desligadas
+static uint32_t hal_flash_begin() {
+#if GENIUS_DUAL_CORE
+    if (multicore_lockout_victim_is_initialized(1 - get_core_num())) {
+        multicore_lockout_start_blocking();
+    }
+#endif
+    return save_and_disable_interrupts();
+}
+
+static void hal_flash_end(uint32_t state) {
+    restore_interrupts(state);
+#if GENIUS_DUAL_CORE
+    if (multicore_lockout_victim_is_initialized(1 - get_core_num())) {
+        multicore_lockout_end_blocking();
+    }
+#endif
+}
+
+// Apaga setores inteiros (offset e length múltiplos de hal_flash_sector_size)
+void hal_flash_erase(uint32_t offset, uint32_t length) {
+    assert(offset % hal_flash_sector_size == 0 && length % hal_flash_sector_size == 0);
+    assert(offset + length <= hal_flash_data_size);
+
+    uint32_t state = hal_flash_begin();
+    flash_range_erase(hal_flash_offset + offset, length);
+    hal_flash_end(state);
+}
+
+// Grava páginas inteiras (offset e length múltiplos de hal_flash_page_size); só zera bits
+void hal_flash_program(uint32_t offset, const uint8_t *data, uint32_t length) {
+    assert(offset % hal_flash_page_size == 0 && length % hal_flash_page_size == 0);
+    assert(offset + length <= hal_flash_data_size);
+
+    uint32_t state = hal_flash_begin();
+    flash_range_program(hal_flash_offset + offset, data, length);
+    hal_flash_end(state);
+}
+
+// Chamada pelo núcleo que não grava a flash, para que ele possa ser pausado durante a gravação
+void hal_flash_lockout_init() {
+#if GENIUS_DUAL_CORE
+    multicore_lockout_victim_init();
+#endif
+}
+
+// ----------------------------------------------------------------------------------------------
+// Porta serial USB: a mesma interface CDC do printf (pico_stdio_usb), escrita direto no buffer do TinyUSB.
+// O stdio_usb roda tud_task() numa interrupção deste núcleo, por isso ela fica desligada durante o acesso
+
+// Há um terminal com a porta aberta (DTR ativo)
+bool hal_usb_connected() {
+    uint32_t state = save_and_disable_interrupts();
+    bool connected = tud_cdc_connected();
+    restore_interrupts(state);
+    return connected;
+}
+
+uint hal_usb_write_available() {
+    uint32_t state = save_and_disable_interrupts();
+    uint available = tud_cdc_connected() ? tud_cdc_write_available() : 0;
+    restore_interrupts(state);
+    return available;
+}
+
+uint hal_usb_write(const uint8_t *data, uint length) {
+    uint32_t state = save_and_disable_interrupts();
+    uint written = 0;
+    if (tud_cdc_connected()) {
+        written = tud_cdc_write(data, MIN(length, tud_cdc_write_available()));
+        tud_cdc_write_flush();
+    }
+    restore_interrupts(state);
+    return written;
+}
@@ -0,0 +1,87 @@
+#include "pico/stdlib.h"
+#include "hal.h"
+#include "joystick.h"
+
+// O DMA escreve continuamente neste anel; com o round-robin começando no eixo X,
+// posições pares são o eixo X (ADC0) e ímpares o eixo Y (ADC1)
+static uint16_t joystick_ring[joystick_ring_length] __attribute__((aligned(joystick_ring_length * sizeof(uint16_t))));
+
+static joystick_direction_t joystick_direction = joystick_center;
+
+// Coloca o ADC em round-robin nos eixos X e Y, gravando continuamente no anel
+void joystick_init(uint x_pin, uint y_pin) {
+    hal_adc_stream_init(x_pin, y_pin, joystick_ring, joystick_ring_length, joystick_sample_rate);
+}
+
+// Para (false) ou retoma a amostragem; parada, a última leitura continua valendo
+void joystick_enable(bool enabled) {
+    hal_adc_stream_enable(enabled);
+}
+
+// Média das últimas amostras de cada eixo, contadas para trás a partir da posição sendo escrita
+void joystick_read(uint16_t *x, uint16_t *y) {
+    uint index = hal_adc_stream_position() & ~1u; // Início do par X/Y que está sendo escrito
+    uint32_t sum_x = 0;
+    uint32_t sum_y = 0;
+
+    for (int i = 0; i < joystick_average; i++) {
+        index = (index - 2) % joystick_ring_length;
+        sum_x += joystick_ring[index];
+        sum_y += joystick_ring[index + 1];
+    }
+
+    *x = sum_x / joystick_average;
+    *y = sum_y / joystick_average;
+}
+
+// Indica se o eixo ainda está fora da faixa central, já descontada a histerese
+static bool joystick_holds(joystick_direction_t direction, uint16_t x, uint16_t y) {
+    switch (direction) {
+        case joystick_left:
+            return x < joystick_low_threshold + joystick_hysteresis;
+        case joystick_right:
+            return x > joystick_high_threshold - joystick_hysteresis;
+        case joystick_up:
+            return y > joystick_high_threshold - joystick_hysteresis;
+        case joystick_down:
+            return y < joystick_low_threshold + joystick_hysteresis;
+        default:
+            return false;
+    }
+}
+
+// Classifica a posição filtrada; para sair de uma direção o eixo precisa voltar além da histerese,
+// o que evita trocas espúrias quando a leitura oscila em torno dos limiares
+static joystick_direction_t joystick_classify(uint16_t x, uint16_t y) {
+    joystick_direction_t entered = joystick_center;
+
+    if (x < joystick_low_threshold) {
+        entered = joystick_left;
+    } else if (x > joystick_high_threshold) {
+        entered = joystick_right;
+    } else if (y > joystick_high_threshold) {
+        entered = joystick_up;
+    } else if (y < joystick_low_threshold) {
+        entered = joystick_down;
+    }
+
+    if (entered == joystick_center && joystick_holds(joystick_direction, x, y)) {
+        return joystick_direction;
+    }
+    return entered;
+}
+
+// Atualiza a direção e retorna true (preenchendo direction) apenas quando ela muda
+bool joystick_poll(joystick_direction_t *direction) {
+    uint16_t x, y;
+
+    joystick_read(&x, &y);
+    joystick_direction_t current = joystick_classify(x, y);
+    if (current == joystick_direction) {
+        return false;
+    }
+
+    joystick_direction = current;
+    *direction = current;
+    return true;
+}
@@ -0,0 +1,27 @@
+#include "pico/stdlib.h"
+
+#ifndef joystick_inc_h
+#define joystick_inc_h
+
+#define joystick_sample_rate 8000  // Conversões por segundo (divididas entre os eixos X e Y)
+#define joystick_ring_length 64    // Amostras no buffer circular do DMA (pares X/Y intercalados)
+#define joystick_average 16        // Amostras por eixo usadas na média (2 ms a 8 kHz)
+
+#define joystick_low_threshold 1000   // Abaixo disso o eixo entra na direção baixa/esquerda
+#define joystick_high_threshold 3000  // Acima disso o eixo entra na direção alta/direita
+#define joystick_hysteresis 200       // Quanto o eixo precisa voltar para sair da direção
+
+typedef enum {
+    joystick_center,
+    joystick_left,
+    joystick_right,
+    joystick_up,
+    joystick_down
+} joystick_direction_t;
+
+extern void joystick_init(uint x_pin, uint y_pin);
+extern void joystick_read(uint16_t *x, uint16_t *y);
+extern bool joystick_poll(joystick_direction_t *direction);
+extern void joystick_enable(bool enabled);
+
+#endif
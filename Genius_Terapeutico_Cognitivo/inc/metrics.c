@@ -0,0 +1,233 @@
+#include <string.h>
+#include "pico/stdlib.h"
+#include "metrics.h"
+
+// Amostra bruta registrada no laço de entrada; o processamento fica para metrics_process()
+typedef struct {
+    uint32_t latency_us;
+    uint16_t round;
+    uint8_t color;
+    bool correct;
+} metrics_sample_t;
+
+static metrics_sample_t metrics_pending[metrics_pending_length];
+static uint metrics_head = 0;
+static uint metrics_tail = 0;
+
+static uint64_t metrics_session_start_us = 0;
+static uint64_t metrics_reference_us = 0; // Fim da apresentação ou última resposta confirmada
+
+static metrics_summary_t metrics_all;
+static metrics_summary_t metrics_by_color[metrics_colors];
+static metrics_stats_t metrics_by_round[metrics_max_rounds];
+
+static void metrics_stats_init(metrics_stats_t *stats) {
+    memset(stats, 0, sizeof(*stats));
+    stats->min_us = UINT32_MAX;
+}
+
+static void metrics_stats_add(metrics_stats_t *stats, uint32_t value) {
+    stats->count++;
+    float delta = value - stats->mean;
+    stats->mean += delta / stats->count;
+    stats->m2 += delta * (value - stats->mean);
+
+    if (value < stats->min_us) {
+        stats->min_us = value;
+    }
+    if (value > stats->max_us) {
+        stats->max_us = value;
+    }
+}
+
+static void metrics_quantile_init(metrics_quantile_t *quantile, float p) {
+    memset(quantile, 0, sizeof(*quantile));
+    quantile->p = p;
+
+    const float desired[5] = { 1, 1 + 2 * p, 1 + 4 * p, 3 + 2 * p, 5 };
+    const float increment[5] = { 0, p / 2, p, (1 + p) / 2, 1 };
+    for (int i = 0; i < 5; i++) {
+        quantile->position[i] = i + 1;
+        quantile->desired[i] = desired[i];
+        quantile->increment[i] = increment[i];
+    }
+}
+
+// Ordena por inserção (no máximo 5 elementos)
+static void metrics_sort(float *values, int count) {
+    for (int i = 1; i < count; i++) {
+        float value = values[i];
+        int j = i - 1;
+        while (j >= 0 && values[j] > value) {
+            values[j + 1] = values[j];
+            j--;
+        }
+        values[j + 1] = value;
+    }
+}
+
+// Ajuste parabólico (P²) da altura do marcador i, deslocado em s posições
+static float metrics_parabolic(const metrics_quantile_t *q, int i, int s) {
+    float span = q->position[i + 1] - q->position[i - 1];
+    float right = (q->position[i] - q->position[i - 1] + s) * (q->height[i + 1] - q->height[i]) / (q->position[i + 1] - q->position[i]);
+    float left = (q->position[i + 1] - q->position[i] - s) * (q->height[i] - q->height[i - 1]) / (q->position[i] - q->position[i - 1]);
+    return q->height[i] + s * (right + left) / span;
+}
+
+static void metrics_quantile_add(metrics_quantile_t *q, float value) {
+    if (q->count < 5) {
+        q->height[q->count++] = value;
+        if (q->count == 5) {
+            metrics_sort(q->height, 5);
+        }
+        return;
+    }
+    q->count++;
+
+    // Localiza a célula da amostra, estendendo os extremos se necessário
+    int cell;
+    if (value < q->height[0]) {
+        q->height[0] = value;
+        cell = 0;
+    } else if (value >= q->height[4]) {
+        q->height[4] = value;
+        cell = 3;
+    } else {
+        cell = 0;
+        while (value >= q->height[cell + 1]) {
+            cell++;
+        }
+    }
+
+    for (int i = cell + 1; i < 5; i++) {
+        q->position[i]++;
+    }
+    for (int i = 0; i < 5; i++) {
+        q->desired[i] += q->increment[i];
+    }
+
+    // Move os marcadores centrais que se afastaram mais de uma posição do desejado
+    for (int i = 1; i <= 3; i++) {
+        float d = q->desired[i] - q->position[i];
+        if ((d >= 1 && q->position[i + 1] - q->position[i] > 1) || (d <= -1 && q->position[i - 1] - q->position[i] < -1)) {
+            int s = d >= 0 ? 1 : -1;
+            float height = metrics_parabolic(q, i, s);
+            if (q->height[i - 1] < height && height < q->height[i + 1]) {
+                q->height[i] = height;
+            } else {
+                q->height[i] += s * (q->height[i + s] - q->height[i]) / (q->position[i + s] - q->position[i]);
+            }
+            q->position[i] += s;
+        }
+    }
+}
+
+static void metrics_summary_init(metrics_summary_t *summary) {
+    metrics_stats_init(&summary->stats);
+    metrics_quantile_init(&summary->median, 0.5f);
+    metrics_quantile_init(&summary->p90, 0.9f);
+    memset(summary->histogram, 0, sizeof(summary->histogram));
+    summary->errors = 0;
+}
+
+static void metrics_summary_add(metrics_summary_t *summary, const metrics_sample_t *sample) {
+    uint bin = sample->latency_us / metrics_histogram_bin_us;
+
+    metrics_stats_add(&summary->stats, sample->latency_us);
+    metrics_quantile_add(&summary->median, sample->latency_us);
+    metrics_quantile_add(&summary->p90, sample->latency_us);
+    if (bin >= metrics_histogram_bins) {
+        bin = metrics_histogram_bins - 1;
+    }
+    if (summary->histogram[bin] < UINT16_MAX) {
+        summary->histogram[bin]++;
+    }
+    if (!sample->correct) {
+        summary->errors++;
+    }
+}
+
+// Zera todas as estatísticas no início de uma sessão
+void metrics_reset(uint64_t session_start_us) {
+    metrics_session_start_us = session_start_us;
+    metrics_reference_us = session_start_us;
+    metrics_head = metrics_tail = 0;
+
+    metrics_summary_init(&metrics_all);
+    for (int i = 0; i < metrics_colors; i++) {
+        metrics_summary_init(&metrics_by_color[i]);
+    }
+    for (int i = 0; i < metrics_max_rounds; i++) {
+        metrics_stats_init(&metrics_by_round[i]);
+    }
+}
+
+// Marca o fim da apresentação da sequência: a primeira resposta é medida a partir daqui
+void metrics_playback_end(uint64_t timestamp_us) {
+    metrics_reference_us = timestamp_us;
+}
+
+// Registra uma resposta confirmada (carimbo de tempo da interrupção do botão).
+// Só guarda a amostra: custo de algumas atribuições no laço de entrada
+void metrics_input(uint8_t color, uint16_t round, uint64_t timestamp_us, bool correct) {
+    if (metrics_head - metrics_tail >= metrics_pending_length) {
+        return; // metrics_process() atrasado demais; descarta em vez de bloquear
+    }
+
+    metrics_sample_t *sample = &metrics_pending[metrics_head % metrics_pending_length];
+    sample->latency_us = timestamp_us - metrics_reference_us;
+    sample->round = round;
+    sample->color = color;
+    sample->correct = correct;
+    metrics_head++;
+
+    metrics_reference_us = timestamp_us; // A próxima resposta é medida a partir desta
+}
+
+// Incorpora as amostras pendentes às estatísticas (chamar fora do caminho crítico)
+void metrics_process() {
+    while (metrics_tail != metrics_head) {
+        const metrics_sample_t *sample = &metrics_pending[metrics_tail % metrics_pending_length];
+
+        metrics_summary_add(&metrics_all, sample);
+        if (sample->color < metrics_colors) {
+            metrics_summary_add(&metrics_by_color[sample->color], sample);
+        }
+        if (sample->round >= 1 && sample->round <= metrics_max_rounds) {
+            metrics_stats_add(&metrics_by_round[sample->round - 1], sample->latency_us);
+        }
+        metrics_tail++;
+    }
+}
+
+// Variância amostral (0 com menos de duas amostras)
+float metrics_variance(const metrics_stats_t *stats) {
+    return stats->count > 1 ? stats->m2 / (stats->count - 1) : 0;
+}
+
+// Valor atual da estimativa; com menos de 5 amostras usa as próprias amostras ordenadas
+float metrics_quantile(const metrics_quantile_t *quantile) {
+    if (quantile->count == 0) {
+        return 0;
+    }
+    if (quantile->count >= 5) {
+        return quantile->height[2];
+    }
+
+    float values[5];
+    memcpy(values, quantile->height, quantile->count * sizeof(float));
+    metrics_sort(values, quantile->count);
+    return values[(int) (quantile->p * (quantile->count - 1) + 0.5f)];
+}
+
+const metrics_summary_t *metrics_overall() {
+    return &metrics_all;
+}
+
+const metrics_summary_t *metrics_color(uint8_t color) {
+    return color < metrics_colors ? &metrics_by_color[color] : NULL;
+}
+
+const metrics_stats_t *metrics_round(uint16_t round) {
+    return (round >= 1 && round <= metrics_max_rounds) ? &metrics_by_round[round - 1] : NULL;
+}
@@ -0,0 +1,51 @@
+#include "pico/stdlib.h"
+#include "sequence.h"
+
+#ifndef metrics_inc_h
+#define metrics_inc_h
+
+#define metrics_colors 4            // Cores do jogo (índices de ColorState)
+#define metrics_max_rounds GENIUS_MAX_ROUNDS // Rodadas com estatística própria (uma por rodada possível)
+#define metrics_pending_length 32   // Amostras aguardando processamento (potência de 2)
+#define metrics_histogram_bins 16   // Faixas do histograma de latência
+#define metrics_histogram_bin_us 100000 // Largura de cada faixa (100 ms); a última acumula o excesso
+
+// Estatística online (Welford): média e variância sem guardar as amostras
+typedef struct {
+    uint32_t count;
+    float mean;       // Em microssegundos
+    float m2;         // Soma dos quadrados dos desvios (variância = m2 / (count - 1))
+    uint32_t min_us;
+    uint32_t max_us;
+} metrics_stats_t;
+
+// Estimador P² de um quantil: cinco marcadores atualizados a cada amostra, memória constante
+typedef struct {
+    float p;
+    float height[5];
+    int position[5];
+    float desired[5];
+    float increment[5];
+    uint32_t count;
+} metrics_quantile_t;
+
+// Resumo completo de um grupo de respostas (sessão inteira ou uma cor)
+typedef struct {
+    metrics_stats_t stats;
+    metrics_quantile_t median;
+    metrics_quantile_t p90;
+    uint16_t histogram[metrics_histogram_bins];
+    uint32_t errors;  // Respostas confirmadas com a cor errada
+} metrics_summary_t;
+
+extern void metrics_reset(uint64_t session_start_us);
+extern void metrics_playback_end(uint64_t timestamp_us);
+extern void metrics_input(uint8_t color, uint16_t round, uint64_t timestamp_us, bool correct);
+extern void metrics_process();
+extern float metrics_variance(const metrics_stats_t *stats);
+extern float metrics_quantile(const metrics_quantile_t *quantile);
+extern const metrics_summary_t *metrics_overall();
+extern const metrics_summary_t *metrics_color(uint8_t color);
+extern const metrics_stats_t *metrics_round(uint16_t round);
+
+#endif
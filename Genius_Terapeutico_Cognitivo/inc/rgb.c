@@ -0,0 +1,108 @@
+#include <math.h>
+#include "pico/stdlib.h"
+#include "hal.h"
+#include "rgb.h"
+
+// LED RGB em PWM de 12 bits com correção gama. As animações são montadas quadro a quadro
+// (rgb_begin, rgb_add...) e tocadas inteiras pelo DMA com rgb_play(), sem a CPU
+
+static uint rgb_pins[3];
+static uint16_t rgb_levels[256]; // Nível de PWM de cada valor perceptual (tabela gama)
+
+static uint16_t rgb_frames[rgb_max_frames][3];
+static uint rgb_frame_count = 0;
+static rgb_color_t rgb_last = { 0, 0, 0 }; // Cor ao fim do que já foi montado (início do próximo esmaecimento)
+
+// Coloca os três pinos em PWM (apagados) e calcula a tabela gama. Deve vir antes de audio_init():
+// o LED verde divide o slice com o buzzer
+void rgb_init(uint red_pin, uint green_pin, uint blue_pin) {
+    rgb_pins[0] = red_pin;
+    rgb_pins[1] = green_pin;
+    rgb_pins[2] = blue_pin;
+    for (uint i = 0; i < 3; i++) {
+        hal_pwm_init(rgb_pins[i]);
+    }
+
+    for (uint i = 0; i < 256; i++) {
+        rgb_levels[i] = (uint16_t) (powf(i / 255.0f, rgb_gamma) * (hal_pwm_wrap + 1) + 0.5f);
+    }
+}
+
+static void rgb_to_levels(uint16_t *levels, rgb_color_t color) {
+    levels[0] = rgb_levels[color.red];
+    levels[1] = rgb_levels[color.green];
+    levels[2] = rgb_levels[color.blue];
+}
+
+// Troca a cor na hora, interrompendo a animação em andamento
+void rgb_set(rgb_color_t color) {
+    uint16_t levels[3];
+
+    hal_pwm_play_stop();
+    rgb_to_levels(levels, color);
+    for (uint i = 0; i < 3; i++) {
+        hal_pwm_level(rgb_pins[i], levels[i]);
+    }
+    rgb_last = color;
+}
+
+// Começa a montar uma animação, a partir da última cor montada ou definida
+void rgb_begin() {
+    rgb_frame_count = 0;
+}
+
+static uint8_t rgb_mix(uint8_t from, uint8_t to, uint step, uint steps) {
+    return (uint8_t) (from + ((int) to - from) * (int) step / (int) steps);
+}
+
+// Acrescenta um passo: esmaece até a cor em fade_ms e a mantém até completar duration_ms.
+// Retorna false (sem acrescentar nada) se o passo não couber no que resta da animação
+bool rgb_add(rgb_color_t color, uint32_t fade_ms, uint32_t duration_ms) {
+    uint frames = (duration_ms * 1000 + rgb_frame_us / 2) / rgb_frame_us;
+    uint fade = (fade_ms * 1000 + rgb_frame_us / 2) / rgb_frame_us;
+
+    if (frames == 0) {
+        frames = 1;
+    }
+    if (fade > frames) {
+        fade = frames;
+    }
+    if (rgb_frame_count + frames > rgb_max_frames) {
+        return false;
+    }
+
+    for (uint f = 0; f < frames; f++) {
+        rgb_color_t mixed = color;
+        if (f < fade) {
+            mixed.red = rgb_mix(rgb_last.red, color.red, f + 1, fade);
+            mixed.green = rgb_mix(rgb_last.green, color.green, f + 1, fade);
+            mixed.blue = rgb_mix(rgb_last.blue, color.blue, f + 1, fade);
+        }
+        rgb_to_levels(rgb_frames[rgb_frame_count++], mixed);
+    }
+    rgb_last = color;
+    return true;
+}
+
+// Toca a animação montada e retorna imediatamente (o primeiro quadro já vale na saída)
+void rgb_play() {
+    hal_pwm_play(rgb_pins, 3, &rgb_frames[0][0], rgb_frame_count, rgb_frame_us);
+}
+
+// Indica se a animação ainda não chegou ao último quadro
+bool rgb_busy() {
+    return hal_pwm_play_busy();
+}
+
+// Interrompe a animação; o LED fica no último quadro aplicado
+void rgb_stop() {
+    hal_pwm_play_stop();
+}
+
+// Para ou religa os slices dos três pinos (modo de repouso). Parado, cada pino fica no nível em que
+// estava; o repouso só chega com o LED apagado e sem animação
+void rgb_enable(bool enabled) {
+    for (uint i = 0; i < 3; i++) {
+        hal_pwm_enable(rgb_pins[i], enabled);
+    }
+}
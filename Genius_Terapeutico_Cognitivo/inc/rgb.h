@@ -0,0 +1,27 @@
+#include "pico/stdlib.h"
+#include "hal.h"
+
+#ifndef rgb_inc_h
+#define rgb_inc_h
+
+#define rgb_frame_us 10000              // Duração de cada quadro das animações (100 quadros por segundo)
+#define rgb_max_frames hal_pwm_max_frames // Quadros por animação (5,12 s a 100 quadros por segundo)
+#define rgb_gamma 2.2f                  // Expoente da correção de brilho (percepção do olho)
+
+// Cor em escala perceptual de 0 a 255 por componente; a correção gama vem na conversão para PWM
+typedef struct {
+    uint8_t red;
+    uint8_t green;
+    uint8_t blue;
+} rgb_color_t;
+
+extern void rgb_init(uint red_pin, uint green_pin, uint blue_pin);
+extern void rgb_set(rgb_color_t color);
+extern void rgb_begin();
+extern bool rgb_add(rgb_color_t color, uint32_t fade_ms, uint32_t duration_ms);
+extern void rgb_play();
+extern bool rgb_busy();
+extern void rgb_stop();
+extern void rgb_enable(bool enabled);
+
+#endif
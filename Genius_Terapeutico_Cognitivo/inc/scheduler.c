@@ -0,0 +1,75 @@
+#include "pico/stdlib.h"
+#include "hal.h"
+#include "scheduler.h"
+
+static task_t scheduler_tasks[scheduler_max_tasks];
+static int scheduler_task_count = 0;
+
+// Registra uma tarefa; com período > 0 ela roda periodicamente a partir de agora.
+// Retorna o identificador usado por scheduler_schedule() e scheduler_wake()
+int scheduler_add_task(task_fn_t run, uint32_t period_us) {
+    assert(scheduler_task_count < scheduler_max_tasks);
+
+    task_t *task = &scheduler_tasks[scheduler_task_count];
+    task->run = run;
+    task->period_us = period_us;
+    task->next_run_us = period_us ? hal_time_us() + period_us : UINT64_MAX;
+    task->pending = false;
+
+    return scheduler_task_count++;
+}
+
+// Agenda (ou reagenda) uma execução da tarefa daqui a delay_us microssegundos
+void scheduler_schedule(int task, uint32_t delay_us) {
+    scheduler_tasks[task].next_run_us = hal_time_us() + delay_us;
+}
+
+// Pede que a tarefa rode o quanto antes; pode ser chamada de interrupções
+void scheduler_wake(int task) {
+    scheduler_tasks[task].pending = true;
+    hal_wake();
+}
+
+// Tira a tarefa (inclusive uma periódica) da agenda até o próximo scheduler_schedule(); acordá-la
+// ainda a executa uma vez
+void scheduler_suspend(int task) {
+    scheduler_tasks[task].next_run_us = UINT64_MAX;
+}
+
+// Laço principal: executa as tarefas vencidas, uma de cada vez até o fim, e dorme (WFE)
+// até o próximo prazo ou até uma interrupção acordar alguma tarefa
+void scheduler_run() {
+    while (true) {
+        uint64_t now = hal_time_us();
+        uint64_t next_deadline = UINT64_MAX;
+
+        for (int i = 0; i < scheduler_task_count; i++) {
+            task_t *task = &scheduler_tasks[i];
+
+            if (task->pending || task->next_run_us <= now) {
+                task->pending = false;
+                if (task->period_us && task->next_run_us != UINT64_MAX) {
+                    task->next_run_us += task->period_us;
+                    if (task->next_run_us <= now) {
+                        task->next_run_us = now + task->period_us; // Atrasada: não tenta recuperar execuções perdidas
+                    }
+                } else {
+                    task->next_run_us = UINT64_MAX;
+                }
+
+                task->run();
+                now = hal_time_us();
+            }
+
+            if (task->pending) {
+                next_deadline = now;
+            } else if (task->next_run_us < next_deadline) {
+                next_deadline = task->next_run_us;
+            }
+        }
+
+        if (next_deadline > now) {
+            hal_wait_until(next_deadline);
+        }
+    }
+}
@@ -0,0 +1,24 @@
+#include "pico/stdlib.h"
+
+#ifndef scheduler_inc_h
+#define scheduler_inc_h
+
+#define scheduler_max_tasks 8 // Número máximo de tarefas registradas
+
+// Tarefa executada até o fim (nunca deve bloquear)
+typedef void (*task_fn_t)(void);
+
+typedef struct {
+    task_fn_t run;
+    uint32_t period_us;       // 0 = executa apenas quando agendada ou acordada
+    uint64_t next_run_us;     // UINT64_MAX = nenhuma execução agendada
+    volatile bool pending;    // Acordada por evento (pode vir de interrupção)
+} task_t;
+
+extern int scheduler_add_task(task_fn_t run, uint32_t period_us);
+extern void scheduler_schedule(int task, uint32_t delay_us);
+extern void scheduler_wake(int task);
+extern void scheduler_suspend(int task);
+extern void scheduler_run();
+
+#endif
@@ -0,0 +1,35 @@
+#include <string.h>
+#include "pico/stdlib.h"
+#include "sequence.h"
+
+// Esvazia a sequência
+void sequence_clear(sequence_t *sequence) {
+    sequence->length = 0;
+    memset(sequence->packed, 0, sizeof(sequence->packed));
+}
+
+// Acrescenta uma cor (0 a 3) ao fim; retorna false se a sequência já está no limite
+bool sequence_append(sequence_t *sequence, uint8_t color) {
+    uint index = sequence->length;
+
+    if (index >= sequence_max_length) {
+        return false;
+    }
+
+    uint shift = (index % sequence_per_byte) * sequence_bits;
+    uint8_t *byte = &sequence->packed[index / sequence_per_byte];
+    *byte = (*byte & ~(0x03 << shift)) | ((color & 0x03) << shift);
+    sequence->length++;
+    return true;
+}
+
+// Cor na posição index (a primeira é 0); lida direto do byte compactado, sem cópia
+uint8_t sequence_get(const sequence_t *sequence, uint index) {
+    assert(index < sequence->length);
+    return (sequence->packed[index / sequence_per_byte] >> ((index % sequence_per_byte) * sequence_bits)) & 0x03;
+}
+
+// Número de cores na sequência
+uint sequence_length(const sequence_t *sequence) {
+    return sequence->length;
+}
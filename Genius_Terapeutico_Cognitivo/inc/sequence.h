@@ -0,0 +1,26 @@
+#include "pico/stdlib.h"
+
+#ifndef sequence_inc_h
+#define sequence_inc_h
+
+// Limite de rodadas de uma sessão; cada rodada acrescenta uma cor à sequência
+#ifndef GENIUS_MAX_ROUNDS
+#define GENIUS_MAX_ROUNDS 500
+#endif
+
+#define sequence_max_length GENIUS_MAX_ROUNDS
+#define sequence_bits 2                            // Bits por cor (quatro cores)
+#define sequence_per_byte (8 / sequence_bits)      // Cores por byte
+
+// Sequência de cores compactada: a cor i ocupa os bits 2*(i%4) e 2*(i%4)+1 do byte i/4
+typedef struct {
+    uint16_t length;
+    uint8_t packed[(sequence_max_length + sequence_per_byte - 1) / sequence_per_byte];
+} sequence_t;
+
+extern void sequence_clear(sequence_t *sequence);
+extern bool sequence_append(sequence_t *sequence, uint8_t color);
+extern uint8_t sequence_get(const sequence_t *sequence, uint index);
+extern uint sequence_length(const sequence_t *sequence);
+
+#endif
@@ -0,0 +1,193 @@
+#include <stddef.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hal.h"
+#include "session_log.h"
+
+// Registro circular na área de dados da flash. Os registros ficam na RAM até completar uma página e
+// são gravados em ordem, uma página inteira por vez; ao entrar num setor novo ele é apagado (o mais
+// antigo), o que distribui o desgaste por todos os setores. Na inicialização, o primeiro registro de
+// cada setor indica onde está a cabeça
+
+static uint session_log_head = 0;        // Próxima posição livre na flash
+static uint32_t session_log_serial = 1;  // Número do próximo registro
+static uint session_log_stored = 0;      // Registros válidos na flash
+
+// Registros aceitos mas ainda não gravados (a gravação para a execução e fica para as pausas do jogo)
+static session_log_record_t session_log_queue[session_log_pending_length];
+static uint session_log_queued = 0;
+
+// CRC-16/CCITT (polinômio 0x1021, valor inicial 0xFFFF)
+static uint16_t session_log_crc(const uint8_t *data, uint length) {
+    uint16_t crc = 0xFFFF;
+
+    for (uint i = 0; i < length; i++) {
+        crc ^= data[i] << 8;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+static const session_log_record_t *session_log_slot(uint position) {
+    return (const session_log_record_t *) (hal_flash_data() + position * session_log_record_size);
+}
+
+static bool session_log_valid(const session_log_record_t *record) {
+    return record->serial != 0xFFFFFFFF &&
+           record->crc == session_log_crc((const uint8_t *) record, offsetof(session_log_record_t, crc));
+}
+
+// Posição apagada: todos os bytes em 0xFF (uma gravação interrompida deixa a posição ocupada)
+static bool session_log_blank(uint position) {
+    const uint8_t *bytes = (const uint8_t *) session_log_slot(position);
+
+    for (uint i = 0; i < session_log_record_size; i++) {
+        if (bytes[i] != 0xFF) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Localiza a cabeça: o setor cujo primeiro registro tem o maior número e, dentro dele, a primeira
+// posição apagada (busca binária, pois as posições ocupadas formam um prefixo do setor)
+void session_log_init() {
+    int head_sector = -1;
+    uint32_t head_serial = 0;
+
+    for (uint sector = 0; sector < session_log_sectors; sector++) {
+        const session_log_record_t *first = session_log_slot(sector * session_log_per_sector);
+        if (session_log_valid(first) && (head_sector < 0 || first->serial > head_serial)) {
+            head_sector = sector;
+            head_serial = first->serial;
+        }
+    }
+
+    session_log_queued = 0;
+    if (head_sector < 0) {
+        session_log_head = 0;
+        session_log_serial = 1;
+        session_log_stored = 0;
+        return;
+    }
+
+    uint base = head_sector * session_log_per_sector;
+    uint low = 1;
+    uint high = session_log_per_sector;
+    while (low < high) {
+        uint middle = (low + high) / 2;
+        if (session_log_blank(base + middle)) {
+            high = middle;
+        } else {
+            low = middle + 1;
+        }
+    }
+    session_log_head = (base + low) % session_log_capacity;
+
+    // O último registro íntegro do setor define a numeração seguinte
+    session_log_serial = head_serial + 1;
+    for (int i = low - 1; i >= 0; i--) {
+        const session_log_record_t *record = session_log_slot(base + i);
+        if (session_log_valid(record)) {
+            session_log_serial = record->serial + 1;
+            break;
+        }
+    }
+
+    // Os demais setores estão cheios (já passados pela cabeça) ou apagados (ainda não usados). Um
+    // primeiro registro interrompido marca o setor que a cabeça começava a usar: ele será apagado
+    session_log_stored = low;
+    for (uint sector = 0; sector < session_log_sectors; sector++) {
+        if (sector != (uint) head_sector && session_log_valid(session_log_slot(sector * session_log_per_sector))) {
+            session_log_stored += session_log_per_sector;
+        }
+    }
+}
+
+// Enfileira um registro (preenche número e CRC); retorna false se a fila estiver cheia
+bool session_log_add(session_log_record_t *record) {
+    if (session_log_queued >= session_log_pending_length) {
+        return false;
+    }
+
+    record->serial = session_log_serial++;
+    record->crc = session_log_crc((const uint8_t *) record, offsetof(session_log_record_t, crc));
+    session_log_queue[session_log_queued++] = *record;
+    return true;
+}
+
+// Indica se os registros na RAM já completam a página da cabeça (trabalho para session_log_commit())
+bool session_log_pending() {
+    return session_log_head % session_log_per_page + session_log_queued >= session_log_per_page;
+}
+
+// Grava os registros da fila a partir da cabeça, uma página por vez, até restarem menos que a página
+// seguinte (partial = false) ou a fila esvaziar (partial = true). A página da cabeça é regravada com o
+// conteúdo anterior mais os registros novos (na NOR, regravar bytes iguais não altera nada)
+static void session_log_write(bool partial) {
+    static uint8_t page[hal_flash_page_size];
+    uint done = 0;
+
+    while (done < session_log_queued &&
+           (partial || session_log_head % session_log_per_page + session_log_queued - done >= session_log_per_page)) {
+        uint page_start = session_log_head - session_log_head % session_log_per_page;
+        uint32_t offset = page_start * session_log_record_size;
+
+        if (session_log_head % session_log_per_sector == 0) {
+            // Setor novo: se já foi usado, seus registros são os mais antigos e saem do registro
+            if (session_log_valid(session_log_slot(session_log_head))) {
+                session_log_stored -= session_log_per_sector;
+            }
+            hal_flash_erase(offset, hal_flash_sector_size);
+        }
+
+        memcpy(page, hal_flash_data() + offset, sizeof(page));
+        do {
+            memcpy(&page[(session_log_head - page_start) * session_log_record_size], &session_log_queue[done++],
+                   session_log_record_size);
+            session_log_head++;
+            session_log_stored++;
+        } while (done < session_log_queued && session_log_head % session_log_per_page != 0);
+
+        hal_flash_program(offset, page, sizeof(page));
+        session_log_head %= session_log_capacity;
+    }
+
+    session_log_queued -= done;
+    memmove(session_log_queue, &session_log_queue[done], session_log_queued * sizeof(session_log_queue[0]));
+}
+
+// Grava as páginas completas; os registros de uma página incompleta continuam na RAM, de modo que
+// cada página é gravada uma vez só. Bloqueia por até dezenas de ms: chamar apenas fora da jogada
+void session_log_commit() {
+    session_log_write(false);
+}
+
+// Grava tudo, inclusive uma página incompleta, que recebe o restante numa segunda gravação depois.
+// Só antes do modo de repouso, quando a RAM pode se perder (bateria retirada) e a regravação é rara
+void session_log_flush() {
+    session_log_write(true);
+}
+
+// Registros disponíveis (gravados e pendentes)
+uint session_log_count() {
+    return session_log_stored + session_log_queued;
+}
+
+// Lê um registro pela idade (0 = o mais recente, inclusive os ainda não gravados)
+bool session_log_read(uint age, session_log_record_t *record) {
+    if (age >= session_log_count()) {
+        return false;
+    }
+    if (age < session_log_queued) {
+        *record = session_log_queue[session_log_queued - 1 - age];
+        return true;
+    }
+
+    age -= session_log_queued;
+    uint position = (session_log_head + session_log_capacity - 1 - age) % session_log_capacity;
+    *record = *session_log_slot(position);
+    return session_log_valid(record);
+}
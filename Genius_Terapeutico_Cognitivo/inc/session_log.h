@@ -0,0 +1,32 @@
+#include "pico/stdlib.h"
+#include "hal.h"
+
+#ifndef session_log_inc_h
+#define session_log_inc_h
+
+#define session_log_record_size 16
+#define session_log_per_page (hal_flash_page_size / session_log_record_size)
+#define session_log_per_sector (hal_flash_sector_size / session_log_record_size)
+#define session_log_sectors (hal_flash_data_size / hal_flash_sector_size)
+#define session_log_capacity (session_log_sectors * session_log_per_sector)
+#define session_log_pending_length (2 * session_log_per_page) // Registros na RAM aguardando gravação
+
+// Resultado de uma partida como fica na flash (16 bytes; o CRC cobre os 14 anteriores)
+typedef struct {
+    uint32_t serial;        // Número crescente do registro (0xFFFFFFFF = posição apagada)
+    uint32_t duration_ms;   // Tempo desde o início da partida
+    uint16_t total_rounds;  // Rodadas escolhidas
+    uint16_t max_rounds;    // Rodadas completadas sem errar
+    uint16_t failed_step;   // Passo do erro (0 = vitória)
+    uint16_t crc;           // CRC-16/CCITT
+} session_log_record_t;
+
+extern void session_log_init();
+extern bool session_log_add(session_log_record_t *record);
+extern bool session_log_pending();
+extern void session_log_commit();
+extern void session_log_flush();
+extern uint session_log_count();
+extern bool session_log_read(uint age, session_log_record_t *record);
+
+#endif
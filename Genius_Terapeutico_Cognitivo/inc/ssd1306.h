@@ -1,17 +1,42 @@
 #include "ssd1306_i2c.h"
 extern void calculate_render_area_buffer_length(struct render_area *area);
-extern void ssd1306_send_command(uint8_t cmd);
-extern void ssd1306_send_command_list(uint8_t *ssd, int number);
-extern void ssd1306_send_buffer(uint8_t ssd[], int buffer_length);
-extern void ssd1306_init();
-extern void ssd1306_scroll(bool set);
-extern void render_on_display(uint8_t *ssd, struct render_area *area);
+extern void ssd1306_window_header(uint8_t header[ssd1306_window_header_length], const struct render_area *area);
+extern void ssd1306_command(ssd1306_t *panel, uint8_t command);
+extern void ssd1306_command_list(ssd1306_t *panel, const uint8_t *commands, int number);
+extern void ssd1306_setup(ssd1306_t *panel, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, uint bus);
+extern void ssd1306_scroll(ssd1306_t *panel, bool set);
+extern void ssd1306_scroll_horizontal(ssd1306_t *panel, bool left, uint8_t start_page, uint8_t end_page,
+                                      ssd1306_scroll_speed_t speed);
+extern void ssd1306_scroll_diagonal(ssd1306_t *panel, bool left, uint8_t start_page, uint8_t end_page,
+                                    ssd1306_scroll_speed_t speed, uint8_t vertical_offset, uint8_t fixed_rows);
+extern void ssd1306_scroll_stop(ssd1306_t *panel);
+extern void ssd1306_set_start_line(ssd1306_t *panel, uint8_t line);
+extern void ssd1306_set_contrast_level(ssd1306_t *panel, uint8_t level);
+extern void ssd1306_set_inverted(ssd1306_t *panel, bool inverted);
+extern void ssd1306_set_display_on(ssd1306_t *panel, bool on);
+extern void ssd1306_invalidate(ssd1306_t *panel);
+extern void ssd1306_frame_init(ssd1306_frame_t *frame);
+extern bool ssd1306_write_areas(ssd1306_t *panel, const struct render_area areas[], int count);
+extern void ssd1306_commit_areas(ssd1306_t *panel, const struct render_area areas[], int count);
+extern void ssd1306_bus_wait(uint bus);
+extern bool ssd1306_async_busy(const ssd1306_t *panel);
+extern void ssd1306_async_wait(const ssd1306_t *panel);
+extern bool ssd1306_queue_areas(ssd1306_t *panel, const struct render_area areas[], int count,
+                                ssd1306_flush_callback_t callback);
 extern void ssd1306_set_pixel(uint8_t *ssd, int x, int y, bool set);
 extern void ssd1306_draw_line(uint8_t *ssd, int x_0, int y_0, int x_1, int y_1, bool set);
+extern void ssd1306_draw_hline(uint8_t *ssd, int x_0, int x_1, int y, bool set);
+extern void ssd1306_draw_vline(uint8_t *ssd, int x, int y_0, int y_1, bool set);
+extern void ssd1306_fill_rect(uint8_t *ssd, int x, int y, int width, int height, bool set);
+extern void ssd1306_draw_rect(uint8_t *ssd, int x, int y, int width, int height, bool set);
+extern void ssd1306_invert_rect(uint8_t *ssd, int x, int y, int width, int height);
+extern void ssd1306_draw_circle(uint8_t *ssd, int x_center, int y_center, int radius, bool set);
+extern void ssd1306_fill_circle(uint8_t *ssd, int x_center, int y_center, int radius, bool set);
+extern void ssd1306_draw_progress(uint8_t *ssd, int x, int y, int width, int height, uint value, uint total);
+extern void ssd1306_draw_round_indicator(uint8_t *ssd, int x_center, int y_center, uint current, uint total);
+extern void ssd1306_draw_sprite(uint8_t *ssd, int16_t x, int16_t y, const ssd1306_sprite_t *sprite, ssd1306_blend_t mode);
 extern void ssd1306_draw_char(uint8_t *ssd, int16_t x, int16_t y, uint8_t character);
-extern void ssd1306_draw_string(uint8_t *ssd, int16_t x, int16_t y, char *string);
-extern void ssd1306_command(ssd1306_t *ssd, uint8_t command);
-extern void ssd1306_config(ssd1306_t *ssd);
-extern void ssd1306_init_bm(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c);
-extern void ssd1306_send_data(ssd1306_t *ssd);
-extern void ssd1306_draw_bitmap(ssd1306_t *ssd, const uint8_t *bitmap);
\ No newline at end of file
+extern void ssd1306_draw_string(uint8_t *ssd, int16_t x, int16_t y, const char *string);
+extern void ssd1306_draw_packed(uint8_t *ssd, int16_t x, int16_t y, const ssd1306_packed_sprite_t *sprite,
+                                ssd1306_blend_t mode);
+extern void ssd1306_draw_text(uint8_t *ssd, int16_t x, int16_t y, const ssd1306_font_t *font, const char *string);
\ No newline at end of file
@@ -0,0 +1,156 @@
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hal.h"
+#include "ssd1306_i2c.h"
+#include "ssd1306.h"
+
+// Fila de envio de cada barramento. Cada barramento tem seu canal de DMA, então i2c0 e i2c1 transmitem
+// ao mesmo tempo; no mesmo barramento os painéis se revezam a cada transação (uma área do quadro),
+// de modo que uma tela inteira num painel não atrasa a atualização pequena de outro
+typedef struct {
+    ssd1306_t *head;             // Painéis com transações esperando, na ordem em que serão atendidos
+    ssd1306_t *tail;
+    ssd1306_t *volatile active;  // Painel com transação no barramento (NULL com o barramento livre)
+} ssd1306_bus_t;
+
+static ssd1306_bus_t ssd1306_buses[ssd1306_bus_count];
+
+static void ssd1306_bus_next(uint bus);
+
+// Põe o painel no fim da fila do barramento
+static void ssd1306_bus_append(ssd1306_bus_t *queue, ssd1306_t *panel) {
+    panel->next = NULL;
+    if (queue->tail) {
+        queue->tail->next = panel;
+    } else {
+        queue->head = panel;
+    }
+    queue->tail = panel;
+}
+
+// Fim de uma transação (em contexto de interrupção): o painel volta ao fim da fila se ainda tiver
+// áreas a enviar. Se o display não respondeu, o restante do quadro é descartado e o próximo envio
+// precisa ser completo
+static void ssd1306_bus_done(uint bus, bool ok) {
+    ssd1306_bus_t *queue = &ssd1306_buses[bus];
+    ssd1306_t *panel = queue->active;
+
+    if (!ok) {
+        panel->stream_position = panel->stream_words;
+        ssd1306_invalidate(panel);
+    }
+
+    if (panel->stream_position < panel->stream_words) {
+        ssd1306_bus_append(queue, panel);
+    } else {
+        panel->busy = false;
+        if (panel->callback) {
+            panel->callback();
+        }
+    }
+    ssd1306_bus_next(bus);
+}
+
+static void ssd1306_bus0_done(bool ok) {
+    ssd1306_bus_done(0, ok);
+}
+
+static void ssd1306_bus1_done(bool ok) {
+    ssd1306_bus_done(1, ok);
+}
+
+// Inicia a próxima transação da fila (com as interrupções desligadas ou dentro delas)
+static void ssd1306_bus_next(uint bus) {
+    ssd1306_bus_t *queue = &ssd1306_buses[bus];
+    ssd1306_t *panel = queue->head;
+
+    if (!panel) {
+        queue->active = NULL;
+        return;
+    }
+    queue->head = panel->next;
+    if (!queue->head) {
+        queue->tail = NULL;
+    }
+
+    uint start = panel->stream_position;
+    uint end = start;
+    while (!(panel->stream[end++] & hal_i2c_stop)) {
+    }
+    panel->stream_position = end;
+
+    queue->active = panel;
+    hal_i2c_write_async(bus, panel->address, &panel->stream[start], end - start,
+                        bus ? ssd1306_bus1_done : ssd1306_bus0_done);
+}
+
+// Aguarda a fila do barramento esvaziar, antes de uma escrita bloqueante
+void ssd1306_bus_wait(uint bus) {
+    while (ssd1306_buses[bus].active) {
+        tight_loop_contents();
+    }
+}
+
+// Acrescenta ao fluxo uma transação com a janela da área seguida de seus dados
+static int ssd1306_stage_area(uint16_t *stream, const uint8_t *ssd, const struct render_area *area) {
+    uint8_t header[ssd1306_window_header_length];
+    int n = 0;
+
+    ssd1306_window_header(header, area);
+    for (uint i = 0; i < sizeof(header); i++) {
+        stream[n++] = header[i];
+    }
+    for (int i = 0; i < area->buffer_length; i++) {
+        stream[n++] = ssd[i];
+    }
+    stream[n - 1] |= hal_i2c_stop;
+
+    return n;
+}
+
+// Indica se o painel ainda tem um quadro sendo transmitido
+bool ssd1306_async_busy(const ssd1306_t *panel) {
+    return panel->busy;
+}
+
+// Aguarda o fim da transmissão do painel (retorna imediatamente se não houver nenhuma)
+void ssd1306_async_wait(const ssd1306_t *panel) {
+    while (panel->busy) {
+        tight_loop_contents();
+    }
+}
+
+// Copia as áreas alteradas do quadro (encontradas pela busca da geometria do painel) para o fluxo do
+// painel, entra na fila do barramento e retorna sem esperar a transmissão. O quadro pode ser redesenhado
+// logo em seguida; o callback (se houver) é chamado em contexto de interrupção ao fim da transmissão.
+// O painel tem um único fluxo, então só pode ser chamada com o painel livre (ver ssd1306_async_busy).
+// Retorna false quando não há nada a enviar
+bool ssd1306_queue_areas(ssd1306_t *panel, const struct render_area areas[], int count,
+                         ssd1306_flush_callback_t callback) {
+    if (count == 0) {
+        return false;
+    }
+
+    uint words = 0;
+    for (int i = 0; i < count; i++) {
+        const uint8_t *span = &panel->frame.data[areas[i].start_page * ssd1306_width + areas[i].start_column];
+        words += ssd1306_stage_area(&panel->stream[words], span, &areas[i]);
+    }
+    ssd1306_commit_areas(panel, areas, count);
+
+    panel->stream_words = words;
+    panel->stream_position = 0;
+    panel->callback = callback;
+    panel->busy = true;
+
+    // Com o barramento livre a primeira transação sai já; senão o painel espera a sua vez
+    uint32_t state = hal_irq_disable();
+    ssd1306_bus_t *queue = &ssd1306_buses[panel->bus];
+    ssd1306_bus_append(queue, panel);
+    if (!queue->active) {
+        ssd1306_bus_next(panel->bus);
+    }
+    hal_irq_restore(state);
+
+    return true;
+}
@@ -0,0 +1,278 @@
+#include <stdlib.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "ssd1306_i2c.h"
+#include "ssd1306.h"
+
+// Primitivas de desenho sobre o quadro (página por página, bit 0 = linha de cima de cada página).
+// Tudo é recortado nas bordas da tela; retas e retângulos escrevem bytes inteiros com máscara
+// em vez de um pixel por vez
+
+// Aplica a operação numa faixa de colunas de uma página, apenas nos bits da máscara
+static inline void ssd1306_span(uint8_t *row, int x_0, int x_1, uint8_t mask, ssd1306_blend_t mode) {
+    switch (mode) {
+        case ssd1306_blend_or:
+            if (mask == 0xFF) {
+                memset(&row[x_0], 0xFF, x_1 - x_0 + 1);
+                return;
+            }
+            for (int x = x_0; x <= x_1; x++) {
+                row[x] |= mask;
+            }
+            break;
+        case ssd1306_blend_and:
+            if (mask == 0xFF) {
+                memset(&row[x_0], 0x00, x_1 - x_0 + 1);
+                return;
+            }
+            for (int x = x_0; x <= x_1; x++) {
+                row[x] &= ~mask;
+            }
+            break;
+        case ssd1306_blend_xor:
+            for (int x = x_0; x <= x_1; x++) {
+                row[x] ^= mask;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+// Preenche o retângulo [x_0, x_1] x [y_0, y_1] (inclusivo) já ordenado: or acende, and apaga, xor inverte
+static void ssd1306_fill_area(uint8_t *ssd, int x_0, int y_0, int x_1, int y_1, ssd1306_blend_t mode) {
+    if (x_0 < 0) {
+        x_0 = 0;
+    }
+    if (y_0 < 0) {
+        y_0 = 0;
+    }
+    if (x_1 >= ssd1306_width) {
+        x_1 = ssd1306_width - 1;
+    }
+    if (y_1 >= ssd1306_height) {
+        y_1 = ssd1306_height - 1;
+    }
+    if (x_0 > x_1 || y_0 > y_1) {
+        return;
+    }
+
+    int first_page = y_0 >> 3;
+    int last_page = y_1 >> 3;
+    uint8_t first_mask = 0xFF << (y_0 & 7);
+    uint8_t last_mask = 0xFF >> (7 - (y_1 & 7));
+
+    for (int page = first_page; page <= last_page; page++) {
+        uint8_t mask = 0xFF;
+        if (page == first_page) {
+            mask &= first_mask;
+        }
+        if (page == last_page) {
+            mask &= last_mask;
+        }
+        ssd1306_span(&ssd[page * ssd1306_width], x_0, x_1, mask, mode);
+    }
+}
+
+static inline ssd1306_blend_t ssd1306_mode_of(bool set) {
+    return set ? ssd1306_blend_or : ssd1306_blend_and;
+}
+
+// Pixel com recorte, sem divisões (usado pelas retas inclinadas e pelos círculos)
+static inline void ssd1306_plot(uint8_t *ssd, int x, int y, bool set) {
+    if ((uint) x >= ssd1306_width || (uint) y >= ssd1306_height) {
+        return;
+    }
+
+    uint8_t *byte = &ssd[(y >> 3) * ssd1306_width + x];
+    uint8_t bit = 1u << (y & 7);
+    *byte = set ? (*byte | bit) : (*byte & ~bit);
+}
+
+// Reta horizontal de x_0 a x_1 (em qualquer ordem) na linha y
+void ssd1306_draw_hline(uint8_t *ssd, int x_0, int x_1, int y, bool set) {
+    if (x_0 > x_1) {
+        int swap = x_0;
+        x_0 = x_1;
+        x_1 = swap;
+    }
+    ssd1306_fill_area(ssd, x_0, y, x_1, y, ssd1306_mode_of(set));
+}
+
+// Reta vertical de y_0 a y_1 (em qualquer ordem) na coluna x: um byte por página
+void ssd1306_draw_vline(uint8_t *ssd, int x, int y_0, int y_1, bool set) {
+    if (y_0 > y_1) {
+        int swap = y_0;
+        y_0 = y_1;
+        y_1 = swap;
+    }
+    ssd1306_fill_area(ssd, x, y_0, x, y_1, ssd1306_mode_of(set));
+}
+
+// Reta entre dois pontos quaisquer; horizontais e verticais usam os caminhos por byte
+void ssd1306_draw_line(uint8_t *ssd, int x_0, int y_0, int x_1, int y_1, bool set) {
+    if (y_0 == y_1) {
+        ssd1306_draw_hline(ssd, x_0, x_1, y_0, set);
+        return;
+    }
+    if (x_0 == x_1) {
+        ssd1306_draw_vline(ssd, x_0, y_0, y_1, set);
+        return;
+    }
+
+    // Algoritmo de Bresenham básico, com recorte por pixel
+    int dx = abs(x_1 - x_0); // Deslocamentos
+    int dy = -abs(y_1 - y_0);
+    int sx = x_0 < x_1 ? 1 : -1; // Direção de avanço
+    int sy = y_0 < y_1 ? 1 : -1;
+    int error = dx + dy; // Erro acumulado
+    int error_2;
+
+    while (true) {
+        ssd1306_plot(ssd, x_0, y_0, set); // Acende pixel no ponto atual
+        if (x_0 == x_1 && y_0 == y_1) {
+            break; // Verifica se o ponto final foi alcançado
+        }
+
+        error_2 = 2 * error; // Ajusta o erro acumulado
+
+        if (error_2 >= dy) {
+            error += dy;
+            x_0 += sx; // Avança na direção x
+        }
+        if (error_2 <= dx) {
+            error += dx;
+            y_0 += sy; // Avança na direção y
+        }
+    }
+}
+
+// Retângulo cheio com canto superior esquerdo em (x, y)
+void ssd1306_fill_rect(uint8_t *ssd, int x, int y, int width, int height, bool set) {
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+    ssd1306_fill_area(ssd, x, y, x + width - 1, y + height - 1, ssd1306_mode_of(set));
+}
+
+// Contorno de retângulo (1 pixel) com canto superior esquerdo em (x, y)
+void ssd1306_draw_rect(uint8_t *ssd, int x, int y, int width, int height, bool set) {
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+
+    int right = x + width - 1;
+    int bottom = y + height - 1;
+    ssd1306_draw_hline(ssd, x, right, y, set);
+    ssd1306_draw_hline(ssd, x, right, bottom, set);
+    ssd1306_draw_vline(ssd, x, y, bottom, set);
+    ssd1306_draw_vline(ssd, right, y, bottom, set);
+}
+
+// Inverte (acende o que está apagado e vice-versa) a região retangular
+void ssd1306_invert_rect(uint8_t *ssd, int x, int y, int width, int height) {
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+    ssd1306_fill_area(ssd, x, y, x + width - 1, y + height - 1, ssd1306_blend_xor);
+}
+
+// Contorno de círculo pelo algoritmo do ponto médio (simetria de oito octantes)
+void ssd1306_draw_circle(uint8_t *ssd, int x_center, int y_center, int radius, bool set) {
+    int x = radius;
+    int y = 0;
+    int error = 1 - radius;
+
+    if (radius < 0) {
+        return;
+    }
+
+    while (x >= y) {
+        ssd1306_plot(ssd, x_center + x, y_center + y, set);
+        ssd1306_plot(ssd, x_center - x, y_center + y, set);
+        ssd1306_plot(ssd, x_center + x, y_center - y, set);
+        ssd1306_plot(ssd, x_center - x, y_center - y, set);
+        ssd1306_plot(ssd, x_center + y, y_center + x, set);
+        ssd1306_plot(ssd, x_center - y, y_center + x, set);
+        ssd1306_plot(ssd, x_center + y, y_center - x, set);
+        ssd1306_plot(ssd, x_center - y, y_center - x, set);
+
+        y++;
+        if (error < 0) {
+            error += 2 * y + 1;
+        } else {
+            x--;
+            error += 2 * (y - x) + 1;
+        }
+    }
+}
+
+// Círculo cheio: colunas verticais simétricas, cada uma escrita por byte
+void ssd1306_fill_circle(uint8_t *ssd, int x_center, int y_center, int radius, bool set) {
+    int x = radius;
+    int y = 0;
+    int error = 1 - radius;
+
+    if (radius < 0) {
+        return;
+    }
+
+    while (x >= y) {
+        ssd1306_draw_vline(ssd, x_center + y, y_center - x, y_center + x, set);
+        if (y) {
+            ssd1306_draw_vline(ssd, x_center - y, y_center - x, y_center + x, set);
+        }
+
+        // As colunas externas só mudam quando x diminui; desenhá-las antes evita repetir a mesma coluna
+        if (error >= 0 && x > y) {
+            ssd1306_draw_vline(ssd, x_center + x, y_center - y, y_center + y, set);
+            ssd1306_draw_vline(ssd, x_center - x, y_center - y, y_center + y, set);
+        }
+
+        y++;
+        if (error < 0) {
+            error += 2 * y + 1;
+        } else {
+            x--;
+            error += 2 * (y - x) + 1;
+        }
+    }
+}
+
+// Barra de progresso: contorno e preenchimento proporcional a value / total (o restante é apagado)
+void ssd1306_draw_progress(uint8_t *ssd, int x, int y, int width, int height, uint value, uint total) {
+    int inner = width - 4;
+    int filled = 0;
+
+    if (width < 5 || height < 5) {
+        return;
+    }
+    if (total) {
+        filled = value >= total ? inner : (int) (value * inner / total);
+    }
+
+    ssd1306_draw_rect(ssd, x, y, width, height, true);
+    ssd1306_fill_rect(ssd, x + 1, y + 1, width - 2, height - 2, false);
+    ssd1306_fill_rect(ssd, x + 2, y + 2, filled, height - 4, true);
+}
+
+// Indicador de rodadas: um círculo por rodada, centralizado em x, cheio para as já completadas e
+// com um ponto no centro para a atual
+void ssd1306_draw_round_indicator(uint8_t *ssd, int x_center, int y_center, uint current, uint total) {
+    const int radius = 3;
+    const int spacing = 2 * radius + 4;
+    int x = x_center - ((int) total - 1) * spacing / 2;
+
+    ssd1306_fill_area(ssd, x - radius, y_center - radius, x + ((int) total - 1) * spacing + radius,
+                      y_center + radius, ssd1306_blend_and);
+    for (uint i = 1; i <= total; i++, x += spacing) {
+        if (i < current) {
+            ssd1306_fill_circle(ssd, x, y_center, radius, true);
+        } else {
+            ssd1306_draw_circle(ssd, x, y_center, radius, true);
+            if (i == current) {
+                ssd1306_fill_rect(ssd, x - 1, y_center - 1, 3, 3, true);
+            }
+        }
+    }
+}
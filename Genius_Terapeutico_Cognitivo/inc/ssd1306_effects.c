@@ -0,0 +1,70 @@
+#include "pico/stdlib.h"
+#include "ssd1306_i2c.h"
+#include "ssd1306.h"
+
+// Efeitos executados pelo próprio controlador: cada chamada é uma única transação de poucos bytes,
+// sem reenviar o quadro. Todas esperam a fila do barramento do painel esvaziar
+
+// Rolagem horizontal contínua das páginas start_page a end_page (para a esquerda ou para a direita)
+void ssd1306_scroll_horizontal(ssd1306_t *panel, bool left, uint8_t start_page, uint8_t end_page,
+                               ssd1306_scroll_speed_t speed) {
+    uint8_t commands[] = {
+        ssd1306_set_scroll, // A configuração só é aceita com a rolagem desativada
+        left ? ssd1306_set_horizontal_scroll_left : ssd1306_set_horizontal_scroll,
+        0x00, start_page, speed, end_page, 0x00, 0xFF,
+        ssd1306_set_scroll | 0x01
+    };
+
+    ssd1306_command_list(panel, commands, count_of(commands));
+}
+
+// Rolagem diagonal: as páginas start_page a end_page andam na horizontal enquanto as linhas abaixo de
+// fixed_rows sobem vertical_offset linhas a cada passo
+void ssd1306_scroll_diagonal(ssd1306_t *panel, bool left, uint8_t start_page, uint8_t end_page,
+                             ssd1306_scroll_speed_t speed, uint8_t vertical_offset, uint8_t fixed_rows) {
+    uint8_t commands[] = {
+        ssd1306_set_scroll,
+        ssd1306_set_vertical_scroll_area, fixed_rows, panel->height - fixed_rows,
+        left ? ssd1306_set_diagonal_scroll_left : ssd1306_set_diagonal_scroll,
+        0x00, start_page, speed, end_page, vertical_offset,
+        ssd1306_set_scroll | 0x01
+    };
+
+    ssd1306_command_list(panel, commands, count_of(commands));
+}
+
+// Interrompe a rolagem. A RAM do painel fica deslocada, então o próximo envio precisa ser completo
+void ssd1306_scroll_stop(ssd1306_t *panel) {
+    ssd1306_command(panel, ssd1306_set_scroll);
+    ssd1306_invalidate(panel);
+}
+
+// Mantida por compatibilidade: rola as quatro primeiras páginas para a direita
+void ssd1306_scroll(ssd1306_t *panel, bool set) {
+    if (set) {
+        ssd1306_scroll_horizontal(panel, false, 0, 3, ssd1306_scroll_frames_5);
+    } else {
+        ssd1306_scroll_stop(panel);
+    }
+}
+
+// Linha da RAM mostrada no topo da tela (0 até a altura - 1): desloca a imagem na vertical, com volta
+void ssd1306_set_start_line(ssd1306_t *panel, uint8_t line) {
+    ssd1306_command(panel, ssd1306_set_display_start_line | (line % panel->height));
+}
+
+// Brilho do painel (0 a 255)
+void ssd1306_set_contrast_level(ssd1306_t *panel, uint8_t level) {
+    uint8_t commands[] = { ssd1306_set_contrast, level };
+    ssd1306_command_list(panel, commands, count_of(commands));
+}
+
+// Inverte todos os pixels na exibição (a RAM não muda)
+void ssd1306_set_inverted(ssd1306_t *panel, bool inverted) {
+    ssd1306_command(panel, inverted ? ssd1306_set_inverse_display : ssd1306_set_normal_display);
+}
+
+// Liga ou desliga o painel mantendo o conteúdo da RAM
+void ssd1306_set_display_on(ssd1306_t *panel, bool on) {
+    ssd1306_command(panel, ssd1306_set_display | (on ? 0x01 : 0x00));
+}
@@ -1,88 +1,109 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
-#include <ctype.h>
 #include "pico/stdlib.h"
-#include "pico/binary_info.h"
-#include "hardware/i2c.h"
-#include "ssd1306_font.h"
+#include "hal.h"
 #include "ssd1306_i2c.h"
+#include "ssd1306.h"
+
+extern void ssd1306_bus_wait(uint bus);
 
 // Calcular quanto do buffer será destinado à área de renderização
 void calculate_render_area_buffer_length(struct render_area *area) {
     area->buffer_length = (area->end_column - area->start_column + 1) * (area->end_page - area->start_page + 1);
 }
 
-// Processo de escrita do i2c espera um byte de controle, seguido por dados
-void ssd1306_send_command(uint8_t command) {
-    uint8_t buffer[2] = {0x80, command};
-    i2c_write_blocking(i2c1, ssd1306_i2c_address, buffer, 2, false);
+// Descarta a cópia do painel, forçando o próximo envio a mandar o quadro inteiro
+void ssd1306_invalidate(ssd1306_t *panel) {
+    panel->shadow_valid = false;
 }
 
-// Envia uma lista de comandos ao hardware
-void ssd1306_send_command_list(uint8_t *ssd, int number) {
-    for (int i = 0; i < number; i++) {
-        ssd1306_send_command(ssd[i]);
-    }
+// Escreve cabeçalho e dados numa única transação I2C, depois que a fila do barramento do painel esvaziar
+static int ssd1306_write(ssd1306_t *panel, const uint8_t *head, size_t head_length,
+                         const uint8_t *data, size_t data_length) {
+    ssd1306_bus_wait(panel->bus); // O barramento pode estar ocupado por envios via DMA deste ou de outro painel
+    return hal_i2c_write(panel->bus, panel->address, head, head_length, data, data_length);
 }
 
-// Copia buffer de referência num novo buffer, a fim de adicionar o byte de controle desde o início
-void ssd1306_send_buffer(uint8_t ssd[], int buffer_length) {
-    uint8_t *temp_buffer = malloc(buffer_length + 1);
-
-    temp_buffer[0] = 0x40;
-    memcpy(temp_buffer + 1, ssd, buffer_length);
-
-    i2c_write_blocking(i2c1, ssd1306_i2c_address, temp_buffer, buffer_length + 1, false);
-
-    free(temp_buffer);
-}
-
-// Cria a lista de comandos (com base nos endereços definidos em ssd1306_i2c.h) para a inicialização do display
-void ssd1306_init() {
-    uint8_t commands[] = {
-        ssd1306_set_display, ssd1306_set_memory_mode, 0x00,
-        ssd1306_set_display_start_line, ssd1306_set_segment_remap | 0x01, 
-        ssd1306_set_mux_ratio, ssd1306_height - 1,
-        ssd1306_set_common_output_direction | 0x08, ssd1306_set_display_offset,
-        0x00, ssd1306_set_common_pin_configuration,
-    
-#if ((ssd1306_width == 128) && (ssd1306_height == 32))
-    0x02,
-#elif ((ssd1306_width == 128) && (ssd1306_height == 64))
-    0x12,
-#else
-    0x02,
-#endif
-        ssd1306_set_display_clock_divide_ratio, 0x80, ssd1306_set_precharge,
-        0xF1, ssd1306_set_vcomh_deselect_level, 0x30, ssd1306_set_contrast,
-        0xFF, ssd1306_set_entire_on, ssd1306_set_normal_display,
-        ssd1306_set_charge_pump, 0x14, ssd1306_set_scroll | 0x00,
-        ssd1306_set_display | 0x01,
+// Monta o cabeçalho que define a janela de escrita e já inicia o fluxo de dados: cada comando vai
+// precedido de 0x80 (Co = 1) e o 0x40 final avisa que o restante da transação são pixels
+void ssd1306_window_header(uint8_t header[ssd1306_window_header_length], const struct render_area *area) {
+    const uint8_t commands[] = {
+        ssd1306_set_column_address, area->start_column, area->end_column,
+        ssd1306_set_page_address, area->start_page, area->end_page
     };
 
-    ssd1306_send_command_list(commands, count_of(commands));
+    for (uint i = 0; i < count_of(commands); i++) {
+        header[2 * i] = 0x80;
+        header[2 * i + 1] = commands[i];
+    }
+    header[ssd1306_window_header_length - 1] = 0x40;
 }
 
-// Cria a lista de comandos para configurar o scrolling
-void ssd1306_scroll(bool set) {
-    uint8_t commands[] = {
-        ssd1306_set_horizontal_scroll | 0x00, 0x00, 0x00, 0x00, 0x03,
-        0x00, 0xFF, ssd1306_set_scroll | (set ? 0x01 : 0)
-    };
-
-    ssd1306_send_command_list(commands, count_of(commands));
+// Processo de escrita do i2c espera um byte de controle, seguido por dados
+void ssd1306_command(ssd1306_t *panel, uint8_t command) {
+    uint8_t buffer[2] = {0x80, command};
+    ssd1306_write(panel, buffer, 2, NULL, 0);
+}
+
+// Envia uma lista de comandos ao hardware numa só transação, com um único byte de controle (0x00)
+void ssd1306_command_list(ssd1306_t *panel, const uint8_t *commands, int number) {
+    const uint8_t control = 0x00;
+    ssd1306_write(panel, &control, 1, commands, number);
+}
+
+// Prepara um quadro vazio com o byte de controle já posicionado
+void ssd1306_frame_init(ssd1306_frame_t *frame) {
+    frame->control = 0x40;
+    memset(frame->data, 0, ssd1306_buffer_length);
+}
+
+// Preenche o painel (largura até ssd1306_width, altura até ssd1306_height, múltipla de 8) com o
+// quadro limpo e prepara o envio assíncrono no barramento. Chamada pelo init de cada geometria gerada
+// por ssd1306_panel.h, que em seguida envia a sequência de comandos
+void ssd1306_setup(ssd1306_t *panel, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, uint bus) {
+    panel->bus = bus;
+    panel->address = address;
+    panel->width = width;
+    panel->height = height;
+    panel->pages = height / ssd1306_page_height;
+    panel->external_vcc = external_vcc;
+    panel->shadow_valid = false;
+    panel->stream_words = 0;
+    panel->stream_position = 0;
+    panel->busy = false;
+    panel->callback = NULL;
+    panel->next = NULL;
+    ssd1306_frame_init(&panel->frame);
+    hal_i2c_async_init(bus);
+}
+
+// Registra na cópia do painel as áreas do quadro que foram (ou estão sendo) enviadas
+void ssd1306_commit_areas(ssd1306_t *panel, const struct render_area areas[], int count) {
+    for (int i = 0; i < count; i++) {
+        int area_width = areas[i].end_column - areas[i].start_column + 1;
+        for (int page = areas[i].start_page; page <= areas[i].end_page; page++) {
+            int offset = page * ssd1306_width + areas[i].start_column;
+            memcpy(&panel->shadow[offset], &panel->frame.data[offset], area_width);
+        }
+    }
+    panel->shadow_valid = true;
 }
 
-// Atualiza uma parte do display com uma área de renderização
-void render_on_display(uint8_t *ssd, struct render_area *area) {
-    uint8_t commands[] = {
-        ssd1306_set_column_address, area->start_column, area->end_column,
-        ssd1306_set_page_address, area->start_page, area->end_page
-    };
+// Envia ao painel as áreas encontradas pela busca de alterações, cada uma com sua janela na mesma
+// transação, e as registra na cópia. Retorna false (sem nenhuma transferência I2C) sem áreas
+bool ssd1306_write_areas(ssd1306_t *panel, const struct render_area areas[], int count) {
+    uint8_t header[ssd1306_window_header_length];
 
-    ssd1306_send_command_list(commands, count_of(commands));
-    ssd1306_send_buffer(ssd, area->buffer_length);
+    for (int i = 0; i < count; i++) {
+        ssd1306_window_header(header, &areas[i]);
+        ssd1306_write(panel, header, sizeof(header),
+                      &panel->frame.data[areas[i].start_page * ssd1306_width + areas[i].start_column],
+                      areas[i].buffer_length);
+    }
+
+    ssd1306_commit_areas(panel, areas, count);
+    return count > 0;
 }
 
 // Determina o pixel a ser aceso (no display) de acordo com a coordenada fornecida
@@ -104,142 +125,30 @@ void ssd1306_set_pixel(uint8_t *ssd, int x, int y, bool set) {
     ssd[byte_idx] = byte;
 }
 
-// Algoritmo de Bresenham básico
-void ssd1306_draw_line(uint8_t *ssd, int x_0, int y_0, int x_1, int y_1, bool set) {
-    int dx = abs(x_1 - x_0); // Deslocamentos
-    int dy = -abs(y_1 - y_0);
-    int sx = x_0 < x_1 ? 1 : -1; // Direção de avanço
-    int sy = y_0 < y_1 ? 1 : -1;
-    int error = dx + dy; // Erro acumulado
-    int error_2;
-
-    while (true) {
-        ssd1306_set_pixel(ssd, x_0, y_0, set); // Acende pixel no ponto atual
-        if (x_0 == x_1 && y_0 == y_1) {
-            break; // Verifica se o ponto final foi alcançado
-        }
-
-        error_2 = 2 * error; // Ajusta o erro acumulado
+// Desenho sobre um quadro qualquer: a geometria do quadro inteiro (ssd1306_width x ssd1306_height),
+// gerada pelo mesmo molde dos painéis
+#define ssd1306_panel_name ssd1306_full
+#define ssd1306_panel_width ssd1306_width
+#define ssd1306_panel_height ssd1306_height
+#include "ssd1306_panel.h"
 
-        if (error_2 >= dy) {
-            error += dy;
-            x_0 += sx; // Avança na direção x
-        }
-        if (error_2 <= dx) {
-            error += dx;
-            y_0 += sy; // Avança na direção y
-        }
-    }
+void ssd1306_draw_sprite(uint8_t *ssd, int16_t x, int16_t y, const ssd1306_sprite_t *sprite, ssd1306_blend_t mode) {
+    ssd1306_full_draw_sprite(ssd, x, y, sprite, mode);
 }
 
-// Adquire os pixels para um caractere (de acordo com ssd1306_font.h)
-inline int ssd1306_get_font(uint8_t character)
-{
-  if (character >= 'A' && character <= 'Z') {
-    return character - 'A' + 1;
-  }
-  else if (character >= '0' && character <= '9') {
-    return character - '0' + 27;
-  }
-  else
-    return 0;
+void ssd1306_draw_packed(uint8_t *ssd, int16_t x, int16_t y, const ssd1306_packed_sprite_t *sprite,
+                         ssd1306_blend_t mode) {
+    ssd1306_full_draw_packed(ssd, x, y, sprite, mode);
 }
 
-// Desenha um único caractere no display
 void ssd1306_draw_char(uint8_t *ssd, int16_t x, int16_t y, uint8_t character) {
-    if (x > ssd1306_width - 8 || y > ssd1306_height - 8) {
-        return;
-    }
-
-    y = y / 8;
-
-    character = toupper(character);
-    int idx = ssd1306_get_font(character);
-    int fb_idx = y * 128 + x;
-
-    for (int i = 0; i < 8; i++) {
-        ssd[fb_idx++] = font[idx * 8 + i];
-    }
+    ssd1306_full_draw_char(ssd, x, y, character);
 }
 
-// Desenha uma string, chamando a função de desenhar caractere várias vezes
-void ssd1306_draw_string(uint8_t *ssd, int16_t x, int16_t y, char *string) {
-    if (x > ssd1306_width - 8 || y > ssd1306_height - 8) {
-        return;
-    }
-
-    while (*string) {
-        ssd1306_draw_char(ssd, x, y, *string++);
-        x += 8;
-    }
+void ssd1306_draw_string(uint8_t *ssd, int16_t x, int16_t y, const char *string) {
+    ssd1306_full_draw_string(ssd, x, y, string);
 }
 
-// Comando de configuração com base na estrutura ssd1306_t
-void ssd1306_command(ssd1306_t *ssd, uint8_t command) {
-  ssd->port_buffer[1] = command;
-  i2c_write_blocking(
-	ssd->i2c_port, ssd->address, ssd->port_buffer, 2, false );
-}
-
-// Função de configuração do display para o caso do bitmap
-void ssd1306_config(ssd1306_t *ssd) {
-    ssd1306_command(ssd, ssd1306_set_display | 0x00);
-    ssd1306_command(ssd, ssd1306_set_memory_mode);
-    ssd1306_command(ssd, 0x01);
-    ssd1306_command(ssd, ssd1306_set_display_start_line | 0x00);
-    ssd1306_command(ssd, ssd1306_set_segment_remap | 0x01);
-    ssd1306_command(ssd, ssd1306_set_mux_ratio);
-    ssd1306_command(ssd, ssd1306_height - 1);
-    ssd1306_command(ssd, ssd1306_set_common_output_direction | 0x08);
-    ssd1306_command(ssd, ssd1306_set_display_offset);
-    ssd1306_command(ssd, 0x00);
-    ssd1306_command(ssd, ssd1306_set_common_pin_configuration);
-    ssd1306_command(ssd, 0x12);
-    ssd1306_command(ssd, ssd1306_set_display_clock_divide_ratio);
-    ssd1306_command(ssd, 0x80);
-    ssd1306_command(ssd, ssd1306_set_precharge);
-    ssd1306_command(ssd, 0xF1);
-    ssd1306_command(ssd, ssd1306_set_vcomh_deselect_level);
-    ssd1306_command(ssd, 0x30);
-    ssd1306_command(ssd, ssd1306_set_contrast);
-    ssd1306_command(ssd, 0xFF);
-    ssd1306_command(ssd, ssd1306_set_entire_on);
-    ssd1306_command(ssd, ssd1306_set_normal_display);
-    ssd1306_command(ssd, ssd1306_set_charge_pump);
-    ssd1306_command(ssd, 0x14);
-    ssd1306_command(ssd, ssd1306_set_display | 0x01);
-}
-
-// Inicializa o display para o caso de exibição de bitmap
-void ssd1306_init_bm(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c) {
-    ssd->width = width;
-    ssd->height = height;
-    ssd->pages = height / 8U;
-    ssd->address = address;
-    ssd->i2c_port = i2c;
-    ssd->bufsize = ssd->pages * ssd->width + 1;
-    ssd->ram_buffer = calloc(ssd->bufsize, sizeof(uint8_t));
-    ssd->ram_buffer[0] = 0x40;
-    ssd->port_buffer[0] = 0x80;
-}
-
-// Envia os dados ao display
-void ssd1306_send_data(ssd1306_t *ssd) {
-    ssd1306_command(ssd, ssd1306_set_column_address);
-    ssd1306_command(ssd, 0);
-    ssd1306_command(ssd, ssd->width - 1);
-    ssd1306_command(ssd, ssd1306_set_page_address);
-    ssd1306_command(ssd, 0);
-    ssd1306_command(ssd, ssd->pages - 1);
-    i2c_write_blocking(
-    ssd->i2c_port, ssd->address, ssd->ram_buffer, ssd->bufsize, false );
-}
-
-// Desenha o bitmap (a ser fornecido em display_oled.c) no display
-void ssd1306_draw_bitmap(ssd1306_t *ssd, const uint8_t *bitmap) {
-    for (int i = 0; i < ssd->bufsize - 1; i++) {
-        ssd->ram_buffer[i + 1] = bitmap[i];
-
-        ssd1306_send_data(ssd);
-    }
+void ssd1306_draw_text(uint8_t *ssd, int16_t x, int16_t y, const ssd1306_font_t *font, const char *string) {
+    ssd1306_full_draw_text(ssd, x, y, font, string);
 }
@@ -1,14 +1,15 @@
 #include <stdlib.h>
 #include "pico/stdlib.h"
-#include "hardware/i2c.h"
 
 #ifndef ssd1306_inc_h
 #define ssd1306_inc_h
 
-#define ssd1306_height 64 // Define a altura do display (32 pixels)
-#define ssd1306_width 128 // Define a largura do display (128 pixels)
+#define ssd1306_height 64 // Altura do maior painel suportado (e do display da placa)
+#define ssd1306_width 128 // Largura do maior painel suportado; também é a largura de cada página do quadro
 
-#define ssd1306_i2c_address _u(0x3C) // Define o endereço do i2c do display
+#define ssd1306_i2c_address _u(0x3C) // Endereço do display da placa (o do paciente)
+#define ssd1306_i2c_bus 1 // Barramento I2C do display da placa (i2c1)
+#define ssd1306_bus_count 2 // Barramentos I2C do RP2040, cada um com sua fila de envio
 
 #define ssd1306_i2c_clock 400 // Define o tempo do clock (pode ser aumentado)
 
@@ -17,7 +18,11 @@
 #define ssd1306_set_column_address _u(0x21)
 #define ssd1306_set_page_address _u(0x22)
 #define ssd1306_set_horizontal_scroll _u(0x26)
+#define ssd1306_set_horizontal_scroll_left _u(0x27)
+#define ssd1306_set_diagonal_scroll _u(0x29)
+#define ssd1306_set_diagonal_scroll_left _u(0x2A)
 #define ssd1306_set_scroll _u(0x2E)
+#define ssd1306_set_vertical_scroll_area _u(0xA3)
 
 #define ssd1306_set_display_start_line _u(0x40)
 
@@ -41,9 +46,16 @@
 #define ssd1306_set_vcomh_deselect_level _u(0xDB)
 
 #define ssd1306_page_height _u(8)
-#define ssd1306_n_pages (ssd1306_height / ssd1306_page_height)
+#define ssd1306_n_pages ((int) (ssd1306_height / ssd1306_page_height)) // int, como as coordenadas de página
 #define ssd1306_buffer_length (ssd1306_n_pages * ssd1306_width)
 
+// Seis comandos de endereçamento, cada um com seu byte de controle, mais o 0x40 que inicia os dados
+#define ssd1306_window_header_length 13
+
+// Fluxo de DMA de um envio assíncrono: cada palavra é um byte do barramento (bits 0-7), com hal_i2c_stop
+// ao fim de cada transação. Pior caso: uma área por página, cada uma com a janela e a largura inteira
+#define ssd1306_async_stream_length (ssd1306_n_pages * (ssd1306_window_header_length + ssd1306_width))
+
 #define ssd1306_write_mode _u(0xFE)
 #define ssd1306_read_mode _u(0xFF)
 
@@ -56,13 +68,85 @@ struct render_area {
     int buffer_length;
 };
 
+// Buffer de quadro com um byte reservado antes dos pixels para o byte de controle (0x40),
+// de modo que o quadro (ou qualquer faixa dele) vai ao I2C sem alocação e sem cópia
 typedef struct {
-  uint8_t width, height, pages, address;
-  i2c_inst_t * i2c_port;
-  bool external_vcc;
-  uint8_t *ram_buffer;
-  size_t bufsize;
-  uint8_t port_buffer[2];
+    uint8_t control;
+    uint8_t data[ssd1306_buffer_length];
+} ssd1306_frame_t;
+
+// Intervalo entre dois passos da rolagem por hardware, em quadros do painel (código do comando 0x26-0x2A)
+typedef enum {
+    ssd1306_scroll_frames_2 = 7,
+    ssd1306_scroll_frames_3 = 4,
+    ssd1306_scroll_frames_4 = 5,
+    ssd1306_scroll_frames_5 = 0,
+    ssd1306_scroll_frames_25 = 6,
+    ssd1306_scroll_frames_64 = 1,
+    ssd1306_scroll_frames_128 = 2,
+    ssd1306_scroll_frames_256 = 3
+} ssd1306_scroll_speed_t;
+
+// Modos de combinação de um sprite com o conteúdo que já está no quadro
+typedef enum {
+    ssd1306_blend_copy, // Substitui os pixels cobertos pelo sprite
+    ssd1306_blend_or,   // Acende os pixels acesos do sprite
+    ssd1306_blend_and,  // Apaga os pixels apagados do sprite
+    ssd1306_blend_xor   // Inverte os pixels acesos do sprite
+} ssd1306_blend_t;
+
+// Sprite no mesmo formato da memória do display: cada byte é uma coluna de 8 pixels (bit 0 em cima)
+// e as páginas ficam em sequência, cada uma com `width` bytes. A altura não precisa ser múltipla de 8
+typedef struct {
+    uint8_t width;
+    uint8_t height;
+    const uint8_t *data;
+} ssd1306_sprite_t;
+
+// Sprite compactado por RLE (PackBits), gerado por host/asset_pack.c. Cada byte de controle n (com sinal)
+// vale n + 1 bytes literais a seguir se n >= 0 ou o byte seguinte repetido 1 - n vezes se n < 0.
+// Descompactado, tem o mesmo formato de ssd1306_sprite_t
+typedef struct {
+    uint8_t width;
+    uint8_t height;
+    uint16_t length; // Bytes compactados em data
+    const uint8_t *data;
+} ssd1306_packed_sprite_t;
+
+// Fonte de largura fixa gerada por host/asset_pack.c: glifos em sequência no formato dos sprites e, para
+// cada código Latin-1, a posição do seu glifo (0 = vazio)
+typedef struct {
+    uint8_t width;
+    uint8_t height;
+    const uint8_t *glyphs;
+    const uint8_t *index;
+} ssd1306_font_t;
+
+// Chamada (em contexto de interrupção) quando um envio assíncrono termina
+typedef void (*ssd1306_flush_callback_t)(void);
+
+// Painel: cada instância tem barramento, endereço, geometria, quadro e cópia do que está no painel.
+// O quadro tem sempre o tamanho do maior painel (páginas de ssd1306_width bytes), e um painel menor
+// usa só o canto superior esquerdo; assim as primitivas de desenho servem a qualquer instância. As
+// funções que dependem da geometria (init, busca de alterações, envio, texto e sprites) são geradas
+// por geometria em ssd1306_panel.h
+typedef struct ssd1306 {
+    uint bus;          // Barramento I2C (0 ou 1)
+    uint8_t address;
+    uint8_t width, height, pages;
+    bool external_vcc;
+    ssd1306_frame_t frame;                 // Quadro em que o programa desenha (frame.data)
+    uint8_t shadow[ssd1306_buffer_length]; // Conteúdo atualmente no painel, para detectar as alterações
+    bool shadow_valid;
+
+    // Envio assíncrono: o fluxo guarda o quadro em trânsito e sai uma transação por vez, em rodízio
+    // com os demais painéis do mesmo barramento
+    uint16_t stream[ssd1306_async_stream_length];
+    uint stream_words;    // Palavras preparadas no fluxo
+    uint stream_position; // Início da próxima transação a enviar
+    volatile bool busy;
+    ssd1306_flush_callback_t callback;
+    struct ssd1306 *next; // Próximo painel na fila do barramento
 } ssd1306_t;
 
 #endif
\ No newline at end of file
@@ -0,0 +1,344 @@
+#include <string.h>
+#include "pico/stdlib.h"
+#include "ssd1306_i2c.h"
+#include "ssd1306.h"
+#include "assets.h"
+
+// Molde de um painel de geometria fixa. Cada inclusão gera, no arquivo que inclui, as funções de
+// inicialização, busca de alterações, envio e desenho de uma geometria, com largura, altura e páginas
+// constantes: os limites de recorte e os laços por página são resolvidos na compilação. Antes de
+// incluir, defina:
+//
+//   ssd1306_panel_name          prefixo das funções geradas (ex.: ssd1306_board -> ssd1306_board_flush)
+//   ssd1306_panel_width         largura, até ssd1306_width
+//   ssd1306_panel_height        altura, até ssd1306_height e múltipla de 8
+//   ssd1306_panel_external_vcc  (opcional) 1 para painéis com alimentação externa
+//
+// Os parâmetros são apagados ao fim, então o mesmo arquivo pode gerar várias geometrias. O quadro de
+// cada painel continua com páginas de ssd1306_width bytes, como em ssd1306_t
+
+#ifndef ssd1306_panel_inc_h
+#define ssd1306_panel_inc_h
+
+#define ssd1306_panel_paste(name, suffix) name ## _ ## suffix
+#define ssd1306_panel_expand(name, suffix) ssd1306_panel_paste(name, suffix)
+#define ssd1306_panel_fn(suffix) ssd1306_panel_expand(ssd1306_panel_name, suffix)
+#define ssd1306_panel_pages ((int) (ssd1306_panel_height / ssd1306_page_height))
+
+// Combina os bits de uma coluna do sprite com um byte do quadro, alterando apenas os bits de mask
+static inline void ssd1306_blend_byte(uint8_t *target, uint8_t bits, uint8_t mask, ssd1306_blend_t mode) {
+    switch (mode) {
+        case ssd1306_blend_copy:
+            *target = (*target & ~mask) | (bits & mask);
+            break;
+        case ssd1306_blend_or:
+            *target |= bits & mask;
+            break;
+        case ssd1306_blend_and:
+            *target &= bits | ~mask;
+            break;
+        case ssd1306_blend_xor:
+            *target ^= bits & mask;
+            break;
+    }
+}
+
+// Lê o próximo caractere de um texto UTF-8 e o converte para Latin-1 (a fonte só vai até U+00FF);
+// sequências fora dessa faixa ou malformadas viram o caractere vazio
+static inline uint8_t ssd1306_next_char(const uint8_t **text) {
+    const uint8_t *s = *text;
+    uint8_t lead = *s++;
+
+    if (lead < 0x80) {
+        *text = s;
+        return lead;
+    }
+
+    uint8_t code = 0;
+    if ((lead & 0xE0) == 0xC0 && (*s & 0xC0) == 0x80) {
+        uint value = ((lead & 0x1F) << 6) | (*s++ & 0x3F);
+        code = value <= 0xFF ? value : 0;
+    }
+    while ((*s & 0xC0) == 0x80) {
+        s++; // Restante de uma sequência longa ou inválida
+    }
+
+    *text = s;
+    return code;
+}
+
+#endif
+
+#ifndef ssd1306_panel_external_vcc
+#define ssd1306_panel_external_vcc 0
+#endif
+
+_Static_assert(ssd1306_panel_width <= ssd1306_width && ssd1306_panel_height <= ssd1306_height &&
+               ssd1306_panel_height % ssd1306_page_height == 0, "geometria fora do quadro do driver");
+
+// Inicializa o painel no barramento já configurado, com o quadro limpo. A sequência de comandos é uma
+// tabela constante (na flash). As interrupções do envio assíncrono são habilitadas no núcleo que chamar
+static inline void ssd1306_panel_fn(init)(ssd1306_t *panel, uint8_t address, uint bus) {
+    static const uint8_t commands[] = {
+        ssd1306_set_display, ssd1306_set_memory_mode, 0x00,
+        ssd1306_set_display_start_line, ssd1306_set_segment_remap | 0x01,
+        ssd1306_set_mux_ratio, ssd1306_panel_height - 1,
+        ssd1306_set_common_output_direction | 0x08, ssd1306_set_display_offset, 0x00,
+        // Pinos COM sequenciais nos painéis de 32 linhas e alternados nos de 64
+        ssd1306_set_common_pin_configuration, (ssd1306_panel_width == 128 && ssd1306_panel_height == 32) ? 0x02 : 0x12,
+        ssd1306_set_display_clock_divide_ratio, 0x80,
+        ssd1306_set_precharge, ssd1306_panel_external_vcc ? 0x22 : 0xF1,
+        ssd1306_set_vcomh_deselect_level, 0x30,
+        ssd1306_set_contrast, 0xFF,
+        ssd1306_set_entire_on, ssd1306_set_normal_display,
+        ssd1306_set_charge_pump, ssd1306_panel_external_vcc ? 0x10 : 0x14,
+        ssd1306_set_scroll | 0x00,
+        ssd1306_set_display | 0x01,
+    };
+
+    ssd1306_setup(panel, ssd1306_panel_width, ssd1306_panel_height, ssd1306_panel_external_vcc, address, bus);
+    ssd1306_command_list(panel, commands, count_of(commands));
+}
+
+// Compara o quadro do painel com a cópia e preenche uma área por faixa alterada (no máximo uma por página).
+// Páginas sem alteração são descartadas com uma comparação da página inteira; as consecutivas alteradas
+// em toda a largura são agrupadas, pois seus dados são contíguos no quadro
+static inline int ssd1306_panel_fn(dirty_areas)(const ssd1306_t *panel, struct render_area areas[]) {
+    const uint8_t *ssd = panel->frame.data;
+    int count = 0;
+
+    for (int page = 0; page < ssd1306_panel_pages; page++) {
+        const uint8_t *row = &ssd[page * ssd1306_width];
+        const uint8_t *shadow_row = &panel->shadow[page * ssd1306_width];
+        int first = 0;
+        int last = ssd1306_panel_width - 1;
+
+        if (panel->shadow_valid) {
+            if (memcmp(row, shadow_row, ssd1306_panel_width) == 0) {
+                continue; // Página sem alterações
+            }
+            while (row[first] == shadow_row[first]) {
+                first++;
+            }
+            while (row[last] == shadow_row[last]) {
+                last--;
+            }
+        }
+
+        // Só um painel da largura do quadro tem páginas inteiras contíguas
+        struct render_area *previous = count > 0 ? &areas[count - 1] : NULL;
+        bool full_width = ssd1306_panel_width == ssd1306_width && first == 0 && last == ssd1306_width - 1;
+
+        if (previous && full_width && previous->end_page == page - 1 &&
+            previous->start_column == 0 && previous->end_column == ssd1306_width - 1) {
+            previous->end_page = page;
+        } else {
+            areas[count].start_column = first;
+            areas[count].end_column = last;
+            areas[count].start_page = page;
+            areas[count].end_page = page;
+            count++;
+        }
+    }
+
+    for (int i = 0; i < count; i++) {
+        areas[i].buffer_length = (areas[i].end_column - areas[i].start_column + 1) *
+                                 (areas[i].end_page - areas[i].start_page + 1);
+    }
+
+    return count;
+}
+
+// Envia ao painel somente as regiões do quadro que mudaram desde o último envio. Retorna false (sem
+// nenhuma transferência I2C) quando já está atualizado
+static inline bool ssd1306_panel_fn(flush)(ssd1306_t *panel) {
+    struct render_area areas[ssd1306_panel_pages];
+
+    return ssd1306_write_areas(panel, areas, ssd1306_panel_fn(dirty_areas)(panel, areas));
+}
+
+// Envio assíncrono das regiões alteradas (ver ssd1306_queue_areas). Com um envio ainda em andamento
+// o quadro nem é comparado e a função retorna false; as alterações ficam para a próxima chamada
+static inline bool ssd1306_panel_fn(flush_async)(ssd1306_t *panel, ssd1306_flush_callback_t callback) {
+    struct render_area areas[ssd1306_panel_pages];
+
+    if (panel->busy) {
+        return false;
+    }
+    return ssd1306_queue_areas(panel, areas, ssd1306_panel_fn(dirty_areas)(panel, areas), callback);
+}
+
+// Copia um sprite para o quadro em qualquer posição (inclusive parcialmente fora da tela).
+// Em y não alinhado cada página do sprite é deslocada e dividida entre duas páginas do quadro
+static inline void ssd1306_panel_fn(draw_sprite)(uint8_t *ssd, int16_t x, int16_t y, const ssd1306_sprite_t *sprite,
+                                                 ssd1306_blend_t mode) {
+    int first_column = x < 0 ? -x : 0;
+    int end_column = sprite->width;
+    if (x + end_column > ssd1306_panel_width) {
+        end_column = ssd1306_panel_width - x;
+    }
+    if (first_column >= end_column) {
+        return;
+    }
+
+    int shift = y & 7;
+    int base_page = (y - shift) / 8; // Divisão arredondada para baixo, também para y negativo
+    int pages = (sprite->height + 7) / 8;
+
+    for (int page = 0; page < pages; page++) {
+        const uint8_t *source = &sprite->data[page * sprite->width];
+        int remaining = sprite->height - page * 8;
+        uint8_t mask = remaining < 8 ? (1u << remaining) - 1 : 0xFF;
+        int upper_page = base_page + page;
+        int lower_page = upper_page + 1;
+
+        if (upper_page >= 0 && upper_page < ssd1306_panel_pages) {
+            uint8_t *target = &ssd[upper_page * ssd1306_width + x];
+
+            if (shift == 0 && mask == 0xFF && mode == ssd1306_blend_copy) {
+                // Caso alinhado à página: cópia direta da linha do sprite
+                memcpy(&target[first_column], &source[first_column], end_column - first_column);
+            } else {
+                uint8_t upper_mask = mask << shift;
+                for (int column = first_column; column < end_column; column++) {
+                    ssd1306_blend_byte(&target[column], source[column] << shift, upper_mask, mode);
+                }
+            }
+        }
+
+        uint8_t lower_mask = shift ? mask >> (8 - shift) : 0;
+        if (lower_mask && lower_page >= 0 && lower_page < ssd1306_panel_pages) {
+            uint8_t *target = &ssd[lower_page * ssd1306_width + x];
+            for (int column = first_column; column < end_column; column++) {
+                ssd1306_blend_byte(&target[column], source[column] >> (8 - shift), lower_mask, mode);
+            }
+        }
+    }
+}
+
+// Descompacta o sprite página por página e desenha cada uma assim que fica completa, sem precisar de
+// um buffer do tamanho da imagem
+static inline void ssd1306_panel_fn(draw_packed)(uint8_t *ssd, int16_t x, int16_t y,
+                                                 const ssd1306_packed_sprite_t *sprite, ssd1306_blend_t mode) {
+    uint8_t row[UINT8_MAX];
+    const uint8_t *data = sprite->data;
+    const uint8_t *end = data + sprite->length;
+    int filled = 0;
+    int page = 0;
+
+    while (data < end && y + page * 8 < ssd1306_panel_height) {
+        int8_t control = (int8_t) *data++;
+        bool literal = control >= 0;
+        int count = literal ? control + 1 : 1 - control;
+
+        if (control == INT8_MIN) {
+            continue; // Sem efeito no PackBits
+        }
+        for (int i = 0; i < count; i++) {
+            row[filled++] = *data;
+            if (literal) {
+                data++;
+            }
+            if (filled == sprite->width) {
+                const ssd1306_sprite_t strip = { sprite->width, MIN(8, sprite->height - page * 8), row };
+                ssd1306_panel_fn(draw_sprite)(ssd, x, y + page * 8, &strip, mode);
+                filled = 0;
+                page++;
+            }
+        }
+        if (!literal) {
+            data++;
+        }
+    }
+}
+
+// Desenha um caractere (código Latin-1) com o canto superior esquerdo em (x, y), recortando o que
+// sair da tela. Alinhado a uma página é só uma cópia de 8 bytes; senão cada coluna se divide entre
+// duas páginas
+static inline void ssd1306_panel_fn(draw_char)(uint8_t *ssd, int16_t x, int16_t y, uint8_t character) {
+    const uint8_t *glyph = &ssd1306_font.glyphs[ssd1306_font.index[character] * 8];
+
+    if (x < 0 || x > ssd1306_panel_width - 8) {
+        // Cortado na lateral: o caminho genérico cuida do recorte das colunas
+        const ssd1306_sprite_t sprite = { 8, 8, glyph };
+        ssd1306_panel_fn(draw_sprite)(ssd, x, y, &sprite, ssd1306_blend_copy);
+        return;
+    }
+
+    int shift = y & 7;
+    int page = (y - shift) / 8; // Divisão arredondada para baixo, também para y negativo
+
+    if (shift == 0) {
+        if (page >= 0 && page < ssd1306_panel_pages) {
+            memcpy(&ssd[page * ssd1306_width + x], glyph, 8);
+        }
+        return;
+    }
+
+    uint8_t upper_mask = 0xFF << shift;
+    if (page >= 0 && page < ssd1306_panel_pages) {
+        uint8_t *target = &ssd[page * ssd1306_width + x];
+        for (int i = 0; i < 8; i++) {
+            target[i] = (target[i] & ~upper_mask) | (glyph[i] << shift);
+        }
+    }
+    if (page + 1 >= 0 && page + 1 < ssd1306_panel_pages) {
+        uint8_t *target = &ssd[(page + 1) * ssd1306_width + x];
+        for (int i = 0; i < 8; i++) {
+            target[i] = (target[i] & upper_mask) | (glyph[i] >> (8 - shift));
+        }
+    }
+}
+
+// Desenha uma string UTF-8 a partir de (x, y), em qualquer linha de pixels; os caracteres que
+// ficarem fora da tela são recortados
+static inline void ssd1306_panel_fn(draw_string)(uint8_t *ssd, int16_t x, int16_t y, const char *string) {
+    const uint8_t *text = (const uint8_t *) string;
+
+    if (y <= -8 || y >= ssd1306_panel_height) {
+        return;
+    }
+
+    while (*text && x < ssd1306_panel_width) {
+        uint8_t character = ssd1306_next_char(&text);
+        if (x > -8) {
+            ssd1306_panel_fn(draw_char)(ssd, x, y, character);
+        }
+        x += 8;
+    }
+}
+
+// Desenha um texto UTF-8 a partir de (x, y) com uma fonte gerada de qualquer tamanho; os caracteres
+// que ficarem fora da tela são recortados
+static inline void ssd1306_panel_fn(draw_text)(uint8_t *ssd, int16_t x, int16_t y, const ssd1306_font_t *font,
+                                               const char *string) {
+    const uint8_t *text = (const uint8_t *) string;
+    int glyph_length = font->width * ((font->height + 7) / 8);
+
+    if (y <= -font->height || y >= ssd1306_panel_height) {
+        return;
+    }
+
+    while (*text && x < ssd1306_panel_width) {
+        uint8_t character = ssd1306_next_char(&text);
+        if (x > -font->width) {
+            const uint8_t *data = &font->glyphs[font->index[character] * glyph_length];
+            const ssd1306_sprite_t glyph = { font->width, font->height, data };
+            ssd1306_panel_fn(draw_sprite)(ssd, x, y, &glyph, ssd1306_blend_copy);
+        }
+        x += font->width;
+    }
+}
+
+// Desenha um bitmap (página por página, ssd1306_panel_width bytes por página) ocupando o painel inteiro
+static inline void ssd1306_panel_fn(draw_bitmap)(ssd1306_t *panel, const uint8_t *bitmap) {
+    for (int page = 0; page < ssd1306_panel_pages; page++) {
+        memcpy(&panel->frame.data[page * ssd1306_width], &bitmap[page * ssd1306_panel_width], ssd1306_panel_width);
+    }
+    ssd1306_panel_fn(flush)(panel);
+}
+
+#undef ssd1306_panel_name
+#undef ssd1306_panel_width
+#undef ssd1306_panel_height
+#undef ssd1306_panel_external_vcc
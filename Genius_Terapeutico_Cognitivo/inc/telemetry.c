@@ -0,0 +1,120 @@
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hal.h"
+#include "telemetry.h"
+
+// Anel de quadros sem trava: só o produtor (telemetry_emit) escreve telemetry_head e só o consumidor
+// (telemetry_drain) escreve telemetry_tail. Os índices crescem livremente; a posição é o índice & máscara.
+// Um quadro que não cabe inteiro é descartado e contado, nunca espera: a entrada do jogador não pode
+// depender da velocidade do host
+
+#define telemetry_mask (telemetry_ring_length - 1)
+
+static uint8_t telemetry_ring[telemetry_ring_length];
+static volatile uint32_t telemetry_head = 0;
+static volatile uint32_t telemetry_tail = 0;
+
+static uint8_t telemetry_sequence = 0;
+static telemetry_drops_t telemetry_drop_count;
+static uint32_t telemetry_drops_reported = 0; // Valor de frames no último quadro telemetry_drops
+static telemetry_notify_t telemetry_notify = NULL;
+
+void telemetry_init(telemetry_notify_t notify) {
+    telemetry_notify = notify;
+}
+
+// CRC-8 (polinômio 0x07, valor inicial 0)
+static uint8_t telemetry_crc(const uint8_t *data, uint length) {
+    uint8_t crc = 0;
+
+    for (uint i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x80) ? (crc << 1) ^ 0x07 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+// Monta o quadro e o copia para o anel, dando a volta no fim se preciso
+static bool telemetry_put(uint8_t type, uint64_t timestamp_us, const void *payload, uint length) {
+    uint8_t frame[telemetry_frame_length(telemetry_max_payload)];
+    uint size = telemetry_frame_length(length);
+    uint32_t head = telemetry_head;
+    uint8_t sequence = telemetry_sequence++;
+
+    if (telemetry_ring_length - (head - telemetry_tail) < size) {
+        telemetry_drop_count.frames++;
+        telemetry_drop_count.bytes += size;
+        return false;
+    }
+
+    frame[0] = telemetry_sync;
+    frame[1] = type;
+    frame[2] = length;
+    frame[3] = sequence;
+    for (int i = 0; i < 4; i++) {
+        frame[4 + i] = (uint32_t) timestamp_us >> (8 * i);
+    }
+    memcpy(&frame[telemetry_header_length], payload, length);
+    frame[size - 1] = telemetry_crc(&frame[1], size - 2);
+
+    uint index = head & telemetry_mask;
+    uint first = MIN(size, telemetry_ring_length - index);
+    memcpy(&telemetry_ring[index], frame, first);
+    memcpy(telemetry_ring, &frame[first], size - first);
+
+    hal_barrier(); // O conteúdo precisa estar no anel antes de o consumidor ver a nova cabeça
+    telemetry_head = head + size;
+    return true;
+}
+
+// Enfileira um quadro; retorna false se ele foi descartado por falta de espaço
+bool telemetry_emit(telemetry_type_t type, uint64_t timestamp_us, const void *payload, uint length) {
+    assert(length <= telemetry_max_payload);
+
+    // Houve descarte desde o último aviso: o host recebe os totais antes do próximo quadro
+    if (telemetry_drop_count.frames != telemetry_drops_reported) {
+        telemetry_drops_t drops = telemetry_drop_count;
+        if (telemetry_put(telemetry_drops, timestamp_us, &drops, sizeof(drops))) {
+            telemetry_drops_reported = drops.frames;
+        }
+    }
+
+    bool queued = telemetry_put(type, timestamp_us, payload, length);
+    if (queued && telemetry_notify) {
+        telemetry_notify();
+    }
+    return queued;
+}
+
+// Passa para a USB os quadros que cabem inteiros no buffer de envio (assim um printf nunca cai no
+// meio de um quadro). Retorna true se ainda sobrou algo no anel
+bool telemetry_drain() {
+    uint32_t tail = telemetry_tail;
+    uint32_t head = telemetry_head;
+
+    hal_barrier();
+    while (tail != head) {
+        uint index = tail & telemetry_mask;
+        uint size = telemetry_frame_length(telemetry_ring[(tail + 2) & telemetry_mask]);
+        if (hal_usb_write_available() < size) {
+            break;
+        }
+
+        uint first = MIN(size, telemetry_ring_length - index);
+        hal_usb_write(&telemetry_ring[index], first);
+        if (first < size) {
+            hal_usb_write(telemetry_ring, size - first);
+        }
+        tail += size;
+    }
+
+    hal_barrier(); // Termina de ler o anel antes de liberar o espaço ao produtor
+    telemetry_tail = tail;
+    return tail != head;
+}
+
+const telemetry_drops_t *telemetry_dropped() {
+    return &telemetry_drop_count;
+}
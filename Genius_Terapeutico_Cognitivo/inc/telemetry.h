@@ -0,0 +1,90 @@
+#include "pico/stdlib.h"
+
+#ifndef telemetry_inc_h
+#define telemetry_inc_h
+
+// Quadro binário (little-endian): marca telemetry_sync, tipo, tamanho do conteúdo, número de sequência,
+// instante em µs (32 bits menos significativos), conteúdo e CRC-8 de tudo entre a marca e o CRC.
+// A sequência avança também nos quadros descartados, então um salto indica perda
+#define telemetry_sync 0xA5
+#define telemetry_version 1
+#define telemetry_header_length 8
+#define telemetry_max_payload 24
+#define telemetry_frame_length(payload) (telemetry_header_length + (payload) + 1)
+#define telemetry_ring_length 1024     // Bytes no anel de quadros (potência de 2)
+#define telemetry_retry_us 10000       // Nova tentativa de envio quando o host não acompanha
+#define telemetry_poll_us 1000000      // Nova verificação sem terminal aberto (o anel enche e conta descartes)
+
+typedef enum {
+    telemetry_boot = 1,  // telemetry_boot_t
+    telemetry_state,     // telemetry_state_t
+    telemetry_joystick,  // Um byte: cor apontada (4 = centro)
+    telemetry_step,      // telemetry_step_t
+    telemetry_session,   // session_log_record_t da partida terminada
+    telemetry_drops,     // telemetry_drops_t
+    telemetry_summary,   // telemetry_summary_t
+    telemetry_histogram, // telemetry_histogram_t
+} telemetry_type_t;
+
+typedef struct __attribute__((packed)) {
+    uint8_t version;       // telemetry_version
+    uint16_t sessions;     // Partidas no registro da flash
+} telemetry_boot_t;
+
+typedef struct __attribute__((packed)) {
+    uint8_t state;         // GameState
+    uint16_t round;
+    uint16_t total_rounds;
+} telemetry_state_t;
+
+// Cor confirmada pelo botão B (o instante do quadro é o da interrupção)
+typedef struct __attribute__((packed)) {
+    uint16_t round;
+    uint16_t step;         // Posição na sequência, a partir de 1
+    uint8_t expected;
+    uint8_t chosen;
+    uint32_t latency_us;   // Desde o fim da apresentação ou a confirmação anterior
+} telemetry_step_t;
+
+// Grupo de respostas de um telemetry_summary_t
+typedef enum {
+    telemetry_summary_session,  // Partida inteira (index = 0)
+    telemetry_summary_color,    // Uma cor (index = ColorState)
+    telemetry_summary_round,    // Uma rodada (index = rodada); sem quantis nem erros
+} telemetry_summary_scope_t;
+
+// Resumo dos tempos de reação de um grupo (inc/metrics.h), em ms saturados em 65535. Enviado ao fim
+// de cada rodada (a rodada) e da partida (a partida e cada cor com respostas)
+typedef struct __attribute__((packed)) {
+    uint8_t scope;         // telemetry_summary_scope_t
+    uint16_t index;
+    uint16_t count;
+    uint16_t errors;
+    uint16_t mean_ms;
+    uint16_t stddev_ms;
+    uint16_t min_ms;
+    uint16_t max_ms;
+    uint16_t median_ms;    // Estimativas P²
+    uint16_t p90_ms;
+} telemetry_summary_t;
+
+// Histograma dos tempos de reação da partida (faixas de metrics_histogram_bin_us, saturadas em 255)
+typedef struct __attribute__((packed)) {
+    uint8_t bins[16];
+} telemetry_histogram_t;
+
+// Totais desde o boot, enviados antes do próximo quadro que couber depois de um descarte
+typedef struct __attribute__((packed)) {
+    uint32_t frames;
+    uint32_t bytes;
+} telemetry_drops_t;
+
+// Chamada quando há quadros novos para enviar
+typedef void (*telemetry_notify_t)(void);
+
+extern void telemetry_init(telemetry_notify_t notify);
+extern bool telemetry_emit(telemetry_type_t type, uint64_t timestamp_us, const void *payload, uint length);
+extern bool telemetry_drain();
+extern const telemetry_drops_t *telemetry_dropped();
+
+#endif
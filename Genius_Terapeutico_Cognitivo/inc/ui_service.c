@@ -0,0 +1,445 @@
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hal.h"
+#include "ssd1306.h"
+#include "audio.h"
+#include "rgb.h"
+#include "ui_service.h"
+
+#if GENIUS_DUAL_CORE
+#include "pico/multicore.h"
+#else
+#include "scheduler.h"
+#endif
+
+// Display do paciente (128x64), com o quadro persistente; o driver compara com o que já está no painel
+// e envia só as diferenças. As funções ssd1306_board_* são geradas para essa geometria
+#define ssd1306_panel_name ssd1306_board
+#define ssd1306_panel_width ssd1306_width
+#define ssd1306_panel_height ssd1306_height
+#include "ssd1306_panel.h"
+
+static ssd1306_t ui_panel;
+static volatile bool ui_display_pending = false; // Há alterações no quadro ainda não enviadas
+static volatile bool ui_display_on = true;       // Desligado, os envios ficam retidos até religar
+static uint ui_buzzer_pin;
+
+// Efeito em andamento: cada passo vencido é aplicado pelo laço do display quando o barramento está livre
+static struct {
+    ui_effect_t kind;
+    uint8_t from, to;
+    uint8_t steps;
+    uint32_t period_us;
+    uint8_t step;      // Próximo passo a aplicar
+    uint64_t next_us;  // Prazo do próximo passo
+} ui_effect;
+
+// Estado do controlador alterado pelos efeitos, para restaurar apenas o que mudou
+static bool ui_scrolling = false; // Durante a rolagem por hardware a RAM do painel não pode ser escrita
+static bool ui_inverted = false;
+static uint8_t ui_contrast = ui_contrast_default;
+static uint8_t ui_start_line = 0;
+
+static void ui_set_inverted(bool inverted) {
+    ui_inverted = inverted;
+    ssd1306_set_inverted(&ui_panel, inverted);
+}
+
+static void ui_set_contrast(uint8_t level) {
+    ui_contrast = level;
+    ssd1306_set_contrast_level(&ui_panel, level);
+}
+
+static void ui_set_start_line(uint8_t line) {
+    ui_start_line = line % ui_panel.height;
+    ssd1306_set_start_line(&ui_panel, ui_start_line);
+}
+
+// Encerra o efeito e devolve o painel ao estado normal (sem rolagem, inversão, deslocamento ou
+// contraste alterado); o nível final de um fade ou deslocamento vale só até a próxima mensagem
+static void ui_effect_finish() {
+    if (ui_scrolling) {
+        ui_scrolling = false;
+        ssd1306_scroll_stop(&ui_panel); // A RAM ficou deslocada: o quadro é reenviado por inteiro
+        ui_display_pending = true;
+    }
+    if (ui_inverted) {
+        ui_set_inverted(false);
+    }
+    if (ui_contrast != ui_contrast_default) {
+        ui_set_contrast(ui_contrast_default);
+    }
+    if (ui_start_line != 0) {
+        ui_set_start_line(0);
+    }
+    ui_effect.kind = ui_effect_none;
+}
+
+// Valor intermediário de uma transição de from até to no passo step (1 a steps)
+static uint8_t ui_effect_level(uint step) {
+    return ui_effect.from + ((int) ui_effect.to - ui_effect.from) * (int) step / ui_effect.steps;
+}
+
+// Aplica o passo vencido do efeito, se houver; não bloqueia esperando um envio em andamento
+static void ui_effect_run() {
+    if (ui_effect.kind == ui_effect_none || hal_time_us() < ui_effect.next_us || ssd1306_async_busy(&ui_panel)) {
+        return;
+    }
+    bool scroll = ui_effect.kind == ui_effect_scroll || ui_effect.kind == ui_effect_diagonal;
+    if (scroll && ui_effect.step == 0 && ui_display_pending) {
+        return; // A rolagem começa depois que o quadro atual chegar ao painel
+    }
+
+    uint step = ++ui_effect.step;
+    ui_effect.next_us += ui_effect.period_us;
+
+    switch (ui_effect.kind) {
+        case ui_effect_flash:
+            ui_set_inverted(step % 2);
+            if (step >= ui_effect.steps) {
+                ui_effect_finish();
+            }
+            break;
+        case ui_effect_fade:
+            ui_set_contrast(ui_effect_level(step));
+            if (step >= ui_effect.steps) {
+                ui_effect.kind = ui_effect_none; // O nível final permanece até a próxima mensagem
+            }
+            break;
+        case ui_effect_pan:
+            ui_set_start_line(ui_effect_level(step));
+            if (step >= ui_effect.steps) {
+                ui_effect.kind = ui_effect_none;
+            }
+            break;
+        case ui_effect_scroll:
+        case ui_effect_diagonal:
+            if (step == 1) {
+                // Um único comando inicia a rolagem; o próximo prazo é o fim dela
+                if (ui_effect.kind == ui_effect_scroll) {
+                    ssd1306_scroll_horizontal(&ui_panel, false, ui_effect.from, ui_effect.to, ssd1306_scroll_frames_4);
+                } else {
+                    ssd1306_scroll_diagonal(&ui_panel, false, ui_effect.from, ui_effect.to, ssd1306_scroll_frames_4,
+                                            1, 0);
+                }
+                ui_scrolling = true;
+                ui_effect.next_us += ui_effect.period_us * (ui_effect.steps - 1);
+            } else {
+                ui_effect_finish();
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+// Prazo do próximo passo do efeito (UINT64_MAX sem efeito em andamento)
+static uint64_t ui_effect_deadline() {
+    return ui_effect.kind == ui_effect_none ? UINT64_MAX : ui_effect.next_us;
+}
+
+// Começa um efeito: o passo inicial (step 0) já é aplicado na primeira passagem do laço
+static void ui_effect_start(const ui_command_t *command) {
+    ui_effect_finish();
+    if (command->effect.kind == ui_effect_none || command->effect.steps == 0) {
+        return;
+    }
+
+    ui_effect.kind = command->effect.kind;
+    ui_effect.from = command->effect.from;
+    ui_effect.to = command->effect.to;
+    ui_effect.steps = command->effect.steps;
+    ui_effect.period_us = command->effect.period_ms * 1000;
+    ui_effect.step = 0;
+    ui_effect.next_us = hal_time_us();
+
+    // Fade e deslocamento partem do valor inicial antes do primeiro intervalo
+    if (ui_effect.kind == ui_effect_fade) {
+        ui_set_contrast(ui_effect.from);
+        ui_effect.next_us += ui_effect.period_us;
+    } else if (ui_effect.kind == ui_effect_pan) {
+        ui_set_start_line(ui_effect.from);
+        ui_effect.next_us += ui_effect.period_us;
+    }
+}
+
+// Desenha uma ou duas linhas de texto num quadro limpo
+static void ui_draw_message(const ui_command_t *command) {
+    ui_effect_finish(); // O efeito pertence à tela anterior
+    memset(ui_panel.frame.data, 0, ssd1306_buffer_length);
+    ssd1306_board_draw_string(ui_panel.frame.data, 5, command->message.line1 * 8, command->message.text1);
+    if (command->message.text2[0]) {
+        ssd1306_board_draw_string(ui_panel.frame.data, 5, command->message.line2 * 8, command->message.text2);
+    }
+    ui_display_pending = true;
+}
+
+// Troca o texto de uma linha (página), mantendo as demais
+static void ui_draw_line(const ui_command_t *command) {
+    int y = command->message.line1 * 8;
+
+    ssd1306_fill_rect(ui_panel.frame.data, 0, y, ssd1306_width, 8, false);
+    ssd1306_board_draw_string(ui_panel.frame.data, 5, y, command->message.text1);
+    ui_display_pending = true;
+}
+
+// Primitivas por byte: barra e círculos podem ser redesenhados a cada atualização sem custo por pixel
+static void ui_draw_progress(const ui_command_t *command) {
+    if (command->type == ui_command_progress) {
+        ssd1306_draw_progress(ui_panel.frame.data, 4, ui_progress_y, ssd1306_width - 8, ui_progress_height,
+                              command->progress.value, command->progress.total);
+    } else {
+        ssd1306_draw_round_indicator(ui_panel.frame.data, ssd1306_width / 2, ui_rounds_y,
+                                     command->progress.value, command->progress.total);
+    }
+    ui_display_pending = true;
+}
+
+// Repouso: encerra efeito e som, para todos os slices de PWM (buzzer e LED RGB) e desliga o painel, que
+// mantém a RAM. Ao religar, a imagem volta com um único comando, sem reinicializar o controlador nem
+// reenviar o quadro
+static void ui_power(bool on) {
+    if (!on) {
+        ui_effect_finish();
+        audio_stop();
+    }
+    hal_pwm_enable(ui_buzzer_pin, on);
+    rgb_enable(on);
+    ssd1306_set_display_on(&ui_panel, on);
+    ui_display_on = on;
+}
+
+// Executa um comando no núcleo que possui o display e o buzzer
+static void ui_execute(const ui_command_t *command) {
+    switch (command->type) {
+        case ui_command_message:
+            ui_draw_message(command);
+            break;
+        case ui_command_line:
+            ui_draw_line(command);
+            break;
+        case ui_command_progress:
+        case ui_command_rounds:
+            ui_draw_progress(command);
+            break;
+        case ui_command_effect:
+            ui_effect_start(command);
+            break;
+        case ui_command_tone:
+            audio_play(command->tone.frequency, command->tone.duration_ms, command->tone.volume);
+            break;
+        case ui_command_clip:
+            audio_play_clip(command->clip.clip, command->clip.volume);
+            break;
+        case ui_command_stop_audio:
+            audio_stop();
+            break;
+        case ui_command_power:
+            ui_power(command->on);
+            break;
+    }
+}
+
+#if GENIUS_DUAL_CORE
+
+// Fila entre núcleos: o núcleo 0 só escreve ui_head e o núcleo 1 só escreve ui_tail
+static ui_command_t ui_queue[ui_queue_length];
+static volatile uint ui_head = 0;
+static volatile uint ui_tail = 0;
+
+// O fim de um envio já tira o núcleo 1 do WFE (toda interrupção acorda o núcleo); nada a fazer aqui
+static void ui_display_flushed() {
+}
+
+static void ui_submit(const ui_command_t *command) {
+    // Fila cheia só acontece se o núcleo 1 estiver muito atrasado; espera uma posição liberar
+    while (ui_head - ui_tail >= ui_queue_length) {
+        tight_loop_contents();
+    }
+
+    ui_queue[ui_head % ui_queue_length] = *command;
+    hal_barrier(); // O comando precisa estar completo antes de o núcleo 1 ver o novo head
+    ui_head++;
+    hal_wake(); // Acorda o núcleo 1
+}
+
+// Laço do núcleo 1: executa os comandos recebidos e os passos de efeito, envia o quadro quando o
+// barramento está livre e dorme (WFE) até chegar comando novo, terminar um envio ou vencer um passo
+static void ui_core1_main() {
+    hal_alarm_init(); // Os alarmes das notas disparam neste núcleo
+    hal_flash_lockout_init(); // O núcleo 0 pode pausar este enquanto grava a flash
+    audio_init(ui_buzzer_pin);
+
+    ssd1306_board_init(&ui_panel, ssd1306_i2c_address, ssd1306_i2c_bus);
+
+    while (true) {
+        while (ui_tail != ui_head) {
+            ui_execute(&ui_queue[ui_tail % ui_queue_length]);
+            hal_barrier();
+            ui_tail++;
+        }
+
+        ui_effect_run();
+        if (ui_display_pending && ui_display_on && !ssd1306_async_busy(&ui_panel) && !ui_scrolling) {
+            ui_display_pending = false;
+            ssd1306_board_flush_async(&ui_panel, ui_display_flushed);
+        }
+
+        // Um passo vencido que esperava o barramento é retomado quando o fim do envio acordar o núcleo
+        uint64_t deadline = ui_effect_deadline();
+        if (ssd1306_async_busy(&ui_panel) && deadline <= hal_time_us()) {
+            deadline = UINT64_MAX;
+        }
+        hal_wait_until(deadline);
+    }
+}
+
+// Inicia o núcleo 1, que passa a ser o dono do display e do buzzer (i2c1 já deve estar configurado)
+void ui_init(uint buzzer_pin) {
+    ui_buzzer_pin = buzzer_pin;
+    multicore_launch_core1(ui_core1_main);
+}
+
+// Display desligado e nenhum comando esperando o núcleo 1 (ele está parado em WFE)
+bool ui_sleeping() {
+    return !ui_display_on && ui_tail == ui_head;
+}
+
+#else
+
+static int ui_display_task_id;
+
+// Chamada pelo driver (em interrupção) ao fim de cada envio do display
+static void ui_display_flushed() {
+    scheduler_wake(ui_display_task_id);
+}
+
+// Tarefa do display: aplica o passo de efeito vencido e envia o quadro pendente assim que o
+// barramento estiver livre (o fim do envio atual acorda a tarefa de novo)
+static void ui_display_task() {
+    ui_effect_run();
+    if (ui_display_pending && ui_display_on && !ssd1306_async_busy(&ui_panel) && !ui_scrolling) {
+        ui_display_pending = false;
+        ssd1306_board_flush_async(&ui_panel, ui_display_flushed);
+    }
+
+    uint64_t deadline = ui_effect_deadline();
+    uint64_t now = hal_time_us();
+    if (deadline != UINT64_MAX && (deadline > now || !ssd1306_async_busy(&ui_panel))) {
+        scheduler_schedule(ui_display_task_id, deadline > now ? deadline - now : 0);
+    }
+}
+
+static void ui_submit(const ui_command_t *command) {
+    ui_execute(command);
+    if (ui_display_pending || ui_effect.kind != ui_effect_none) {
+        scheduler_wake(ui_display_task_id);
+    }
+}
+
+// Inicializa display e buzzer no próprio núcleo 0 (i2c1 já deve estar configurado)
+void ui_init(uint buzzer_pin) {
+    ui_buzzer_pin = buzzer_pin;
+    audio_init(buzzer_pin);
+
+    ssd1306_board_init(&ui_panel, ssd1306_i2c_address, ssd1306_i2c_bus);
+    ui_display_task_id = scheduler_add_task(ui_display_task, 0);
+}
+
+// Os comandos rodam na hora: basta o display estar desligado
+bool ui_sleeping() {
+    return !ui_display_on;
+}
+
+#endif
+
+// Exibe uma mensagem numa linha (página) do display
+void ui_show_message(const char *message, int line) {
+    ui_show_two_messages(message, line, "", 0);
+}
+
+// Exibe duas mensagens, cada uma em sua linha
+void ui_show_two_messages(const char *message1, int line1, const char *message2, int line2) {
+    ui_command_t command = { .type = ui_command_message };
+
+    command.message.line1 = line1;
+    command.message.line2 = line2;
+    strncpy(command.message.text1, message1, ui_text_length - 1);
+    strncpy(command.message.text2, message2, ui_text_length - 1);
+    ui_submit(&command);
+}
+
+// Escreve uma linha a mais na tela atual (a mensagem anterior continua)
+void ui_show_line(const char *message, int line) {
+    ui_command_t command = { .type = ui_command_line };
+
+    command.message.line1 = line;
+    strncpy(command.message.text1, message, ui_text_length - 1);
+    ui_submit(&command);
+}
+
+// Mostra no rodapé uma barra preenchida na proporção value / total
+void ui_show_progress(uint value, uint total) {
+    ui_command_t command = { .type = ui_command_progress };
+
+    command.progress.value = value;
+    command.progress.total = total;
+    ui_submit(&command);
+}
+
+// Mostra no topo um círculo por rodada: cheios os já completados, marcado o atual
+void ui_show_rounds(uint current, uint total) {
+    ui_command_t command = { .type = ui_command_rounds };
+
+    command.progress.value = current;
+    command.progress.total = MIN(total, ui_rounds_max);
+    ui_submit(&command);
+}
+
+// Inicia um efeito do display (veja ui_effect_t); um efeito novo ou uma mensagem nova encerram o anterior
+void ui_start_effect(ui_effect_t kind, uint8_t from, uint8_t to, uint8_t steps, uint16_t period_ms) {
+    ui_command_t command = { .type = ui_command_effect };
+
+    command.effect.kind = kind;
+    command.effect.from = from;
+    command.effect.to = to;
+    command.effect.steps = steps;
+    command.effect.period_ms = period_ms;
+    ui_submit(&command);
+}
+
+// Encerra o efeito em andamento e devolve o display ao estado normal
+void ui_stop_effect() {
+    ui_start_effect(ui_effect_none, 0, 0, 0, 0);
+}
+
+// Toca uma nota sem bloquear (frequência 0 = pausa)
+void ui_play_tone(uint32_t frequency, uint32_t duration_ms, uint8_t volume) {
+    ui_command_t command = { .type = ui_command_tone };
+
+    command.tone.frequency = frequency;
+    command.tone.duration_ms = duration_ms;
+    command.tone.volume = volume;
+    ui_submit(&command);
+}
+
+// Toca um clipe gravado (voz ou som) sem bloquear, depois das notas já enfileiradas
+void ui_play_clip(const audio_clip_t *clip, uint8_t volume) {
+    ui_command_t command = { .type = ui_command_clip };
+
+    command.clip.clip = clip;
+    command.clip.volume = volume;
+    ui_submit(&command);
+}
+
+// Silencia o buzzer e descarta as notas e o clipe pendentes
+void ui_stop_audio() {
+    ui_command_t command = { .type = ui_command_stop_audio };
+    ui_submit(&command);
+}
+
+// Desliga (repouso) ou religa o display e o buzzer; a imagem do painel é preservada
+void ui_set_power(bool on) {
+    ui_command_t command = { .type = ui_command_power, .on = on };
+    ui_submit(&command);
+}
@@ -0,0 +1,87 @@
+#include "pico/stdlib.h"
+#include "audio.h"
+
+#ifndef ui_service_inc_h
+#define ui_service_inc_h
+
+// 1 = display e buzzer atendidos pelo núcleo 1; 0 = tudo no núcleo 0 (via escalonador)
+#ifndef GENIUS_DUAL_CORE
+#define GENIUS_DUAL_CORE 1
+#endif
+
+#define ui_queue_length 32  // Comandos aguardando o núcleo 1 (potência de 2; cabe um lote de notas do LED)
+#define ui_text_length 24   // Maior texto de uma linha, incluindo o terminador
+
+#define ui_progress_y 54       // Barra de progresso no rodapé (abaixo das linhas de texto)
+#define ui_progress_height 9
+#define ui_rounds_y 4          // Centro do indicador de rodadas, na primeira página
+#define ui_rounds_max 12       // Mais círculos que isso não cabem na largura da tela
+#define ui_contrast_default 0xFF // Contraste configurado por ssd1306_init()
+
+// Efeitos executados pelo controlador do display (poucos bytes de comando por passo, sem reenviar o quadro)
+typedef enum {
+    ui_effect_none,
+    ui_effect_flash,    // Alterna o modo inverso: steps fases de period_ms, terminando no modo normal
+    ui_effect_fade,     // Contraste de from até to em steps passos de period_ms (o nível final permanece)
+    ui_effect_pan,      // Linha inicial de from até to em steps passos de period_ms (desliza a imagem)
+    ui_effect_scroll,   // Rolagem horizontal das páginas from a to por steps * period_ms
+    ui_effect_diagonal  // Rolagem diagonal (páginas from a to andam, a tela toda sobe) por steps * period_ms
+} ui_effect_t;
+
+typedef enum {
+    ui_command_message,    // Limpa o quadro e escreve uma ou duas linhas de texto
+    ui_command_line,       // Reescreve uma linha de texto sem apagar o restante do quadro
+    ui_command_progress,   // Redesenha a barra de progresso sem apagar o restante do quadro
+    ui_command_rounds,     // Redesenha o indicador de rodadas sem apagar o restante do quadro
+    ui_command_effect,     // Inicia um efeito do display (substitui o que estiver em andamento)
+    ui_command_tone,       // Enfileira uma nota no buzzer
+    ui_command_clip,       // Toca um clipe gravado no buzzer
+    ui_command_stop_audio, // Interrompe o som e descarta as notas pendentes
+    ui_command_power       // Liga ou desliga o display e o buzzer (modo de repouso)
+} ui_command_type_t;
+
+typedef struct {
+    ui_command_type_t type;
+    union {
+        struct {
+            uint8_t line1, line2;
+            char text1[ui_text_length];
+            char text2[ui_text_length]; // Vazio = apenas uma linha
+        } message;
+        struct {
+            uint16_t value, total;
+        } progress; // Usado também pelo indicador de rodadas (rodada atual e total)
+        struct {
+            uint8_t kind; // ui_effect_t
+            uint8_t from, to;
+            uint8_t steps;
+            uint16_t period_ms;
+        } effect;
+        struct {
+            uint32_t frequency;
+            uint32_t duration_ms;
+            uint8_t volume;
+        } tone;
+        struct {
+            const audio_clip_t *clip;
+            uint8_t volume;
+        } clip;
+        bool on; // ui_command_power
+    };
+} ui_command_t;
+
+extern void ui_init(uint buzzer_pin);
+extern void ui_show_message(const char *message, int line);
+extern void ui_show_two_messages(const char *message1, int line1, const char *message2, int line2);
+extern void ui_show_line(const char *message, int line);
+extern void ui_show_progress(uint value, uint total);
+extern void ui_show_rounds(uint current, uint total);
+extern void ui_start_effect(ui_effect_t kind, uint8_t from, uint8_t to, uint8_t steps, uint16_t period_ms);
+extern void ui_stop_effect();
+extern void ui_play_tone(uint32_t frequency, uint32_t duration_ms, uint8_t volume);
+extern void ui_play_clip(const audio_clip_t *clip, uint8_t volume);
+extern void ui_stop_audio();
+extern void ui_set_power(bool on);
+extern bool ui_sleeping();
+
+#endif